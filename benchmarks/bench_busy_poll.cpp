@@ -0,0 +1,76 @@
+/// \file bench_busy_poll.cpp
+/// \brief Reports the pass-to-pass gap distribution of the runner's busy-poll mode.
+///
+/// Usage: `bench_busy_poll [duration_ms] [cpu]`
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+class EmptyComponent final :
+        public consolix::IAppComponent,
+        public consolix::IWorkReporter {
+public:
+    std::size_t last_work_count() const override {
+        return 0;
+    }
+
+protected:
+    bool initialize() override {
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {}
+
+private:
+    bool m_initialized{false};
+};
+
+void run(int duration_ms, int cpu) {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    manager.add<EmptyComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    runner.enable_busy_poll(cpu);
+    std::thread controller([&runner, duration_ms]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(duration_ms));
+        runner.request_stop(0);
+    });
+    runner.run_for_exit_code();
+    controller.join();
+
+    const consolix::BusyPollReport report = runner.busy_poll_report();
+    std::cout << std::setw(8) << cpu << std::setw(8) << (report.pinned ? "yes" : "no")
+              << std::setw(14) << report.iterations
+              << std::setw(10) << report.gaps.percentile(0.50)
+              << std::setw(10) << report.gaps.percentile(0.99)
+              << std::setw(10) << report.gaps.percentile(0.999)
+              << std::setw(12) << report.gaps.max() << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int duration_ms = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const int cpu = argc > 2 ? std::atoi(argv[2]) : 0;
+
+    std::cout << "Busy-poll pass-to-pass gap over " << duration_ms << " ms (ns)" << std::endl;
+    std::cout << std::setw(8) << "cpu" << std::setw(8) << "pinned" << std::setw(14) << "passes"
+              << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "p999"
+              << std::setw(12) << "max" << std::endl;
+    run(duration_ms, -1);
+    run(duration_ms, cpu);
+    return 0;
+}
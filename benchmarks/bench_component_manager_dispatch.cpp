@@ -0,0 +1,96 @@
+/// \file bench_component_manager_dispatch.cpp
+/// \brief Compares per-iteration loop overhead of the dynamic and static component managers.
+///
+/// Usage: `bench_component_manager_dispatch [iterations]`
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+template <int Id>
+class CounterComponent final : public consolix::IAppComponent {
+public:
+    std::uint64_t count() const {
+        return m_count;
+    }
+
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {
+        m_count = m_count + 1;
+    }
+
+private:
+    volatile std::uint64_t m_count{0};
+};
+
+typedef consolix::StaticComponentManager<
+    CounterComponent<0>, CounterComponent<1>, CounterComponent<2>, CounterComponent<3>,
+    CounterComponent<4>, CounterComponent<5>, CounterComponent<6>, CounterComponent<7>> StaticManager;
+
+const std::size_t component_count = StaticManager::component_count;
+
+template <typename Manager>
+double measure(Manager& manager, long long iterations) {
+    const auto begin = std::chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i) {
+        manager.process();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) /
+        static_cast<double>(iterations);
+}
+
+void print_row(const char* name, double ns_per_iteration) {
+    std::cout << std::setw(28) << std::left << name
+              << std::setw(14) << std::right << std::fixed << std::setprecision(2) << ns_per_iteration
+              << std::setw(14) << ns_per_iteration / static_cast<double>(component_count) << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const long long iterations = argc > 1 ? std::atoll(argv[1]) : 20000000;
+
+    consolix::AppComponentManager dynamic_manager;
+    dynamic_manager.add<CounterComponent<0>>();
+    dynamic_manager.add<CounterComponent<1>>();
+    dynamic_manager.add<CounterComponent<2>>();
+    dynamic_manager.add<CounterComponent<3>>();
+    dynamic_manager.add<CounterComponent<4>>();
+    dynamic_manager.add<CounterComponent<5>>();
+    dynamic_manager.add<CounterComponent<6>>();
+    dynamic_manager.add<CounterComponent<7>>();
+
+    StaticManager static_manager;
+    consolix::IComponentManager& static_interface = static_manager;
+
+    std::cout << "Component manager loop overhead, " << component_count << " components" << std::endl;
+    std::cout << std::setw(28) << std::left << "manager"
+              << std::setw(14) << std::right << "ns/iter"
+              << std::setw(14) << "ns/component" << std::endl;
+
+    print_row("AppComponentManager", measure(dynamic_manager, iterations));
+    print_row("StaticComponentManager", measure(static_manager, iterations));
+    print_row("Static via IComponentManager", measure(static_interface, iterations));
+
+    if (static_manager.get<7>().count() != static_cast<std::uint64_t>(iterations) * 2) {
+        std::cerr << "unexpected process count" << std::endl;
+        return 1;
+    }
+    return 0;
+}
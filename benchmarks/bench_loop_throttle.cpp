@@ -0,0 +1,81 @@
+/// \file bench_loop_throttle.cpp
+/// \brief Compares the cadence of `LoopThrottleComponent` in delay, fixed-rate and hybrid modes.
+///
+/// Usage: `bench_loop_throttle [ticks] [work_us] [period_us]`
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <consolix/core.hpp>
+#include <consolix/components.hpp>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+/// \brief Busy work of a fixed duration, standing in for a control step.
+void work_for(std::chrono::microseconds duration) {
+    const Clock::time_point until = Clock::now() + duration;
+    while (Clock::now() < until) {
+    }
+}
+
+void run(const char* mode, bool fixed_rate, bool hybrid, int ticks,
+         std::chrono::microseconds work, std::chrono::microseconds period) {
+    consolix::AppComponentManager manager;
+    auto throttle = manager.add<consolix::LoopThrottleComponent>(period);
+    manager.initialize();
+    throttle->set_hybrid_wait(hybrid);
+    if (fixed_rate) {
+        throttle->set_fixed_rate(period);
+        manager.process();
+    }
+
+    consolix::LatencyHistogram periods;
+    Clock::time_point previous = Clock::now();
+    const Clock::time_point start = previous;
+    for (int i = 0; i < ticks; ++i) {
+        manager.process();
+        const Clock::time_point now = Clock::now();
+        periods.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - previous).count()));
+        previous = now;
+        work_for(work);
+    }
+    const double elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    const double expected_ms = static_cast<double>(ticks) * static_cast<double>(period.count()) / 1000.0;
+    std::cout << std::setw(14) << std::left << mode << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << elapsed_ms / ticks * 1000.0
+              << std::setw(12) << periods.percentile(0.50) / 1000.0
+              << std::setw(12) << periods.percentile(0.99) / 1000.0
+              << std::setw(12) << periods.max() / 1000.0
+              << std::setw(14) << elapsed_ms - expected_ms;
+    if (fixed_rate) {
+        const consolix::LoopThrottleComponent::TickStats stats = throttle->tick_stats();
+        std::cout << std::setw(14) << stats.lateness.percentile(0.50) / 1000.0
+                  << std::setw(14) << stats.lateness.percentile(0.99) / 1000.0;
+    }
+    std::cout << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int ticks = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const std::chrono::microseconds work(argc > 2 ? std::atoi(argv[2]) : 200);
+    const std::chrono::microseconds period(argc > 3 ? std::atoi(argv[3]) : 1000);
+
+    std::cout << "LoopThrottleComponent at " << period.count() << " us with " << work.count()
+              << " us of work per pass (us)" << std::endl;
+    std::cout << std::setw(14) << std::left << "mode" << std::right << std::setw(12) << "mean"
+              << std::setw(12) << "p50" << std::setw(12) << "p99" << std::setw(12) << "max"
+              << std::setw(14) << "drift (ms)" << std::setw(14) << "late p50" << std::setw(14) << "late p99"
+              << std::endl;
+    run("delay", false, false, ticks, work, period);
+    run("fixed-rate", true, false, ticks, work, period);
+    run("fixed+hybrid", true, true, ticks, work, period);
+    return 0;
+}
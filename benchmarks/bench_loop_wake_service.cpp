@@ -0,0 +1,130 @@
+/// \file bench_loop_wake_service.cpp
+/// \brief Measures `LoopWakeService` wake throughput and wake-to-run latency.
+///
+/// Usage: `bench_loop_wake_service [wake_calls] [latency_rounds]`
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+volatile std::uint64_t generation_sink = 0;
+
+double measure_wake_all(consolix::LoopWakeService& service, long long calls) {
+    const auto begin = Clock::now();
+    for (long long i = 0; i < calls; ++i) {
+        service.wake_all();
+    }
+    const auto end = Clock::now();
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) /
+        static_cast<double>(calls);
+}
+
+double measure_channel_wake(consolix::LoopWakeService& service, long long calls) {
+    const consolix::LoopWakeService::Channel channel = service.channel("bench");
+    const auto begin = Clock::now();
+    for (long long i = 0; i < calls; ++i) {
+        service.wake(channel);
+    }
+    const auto end = Clock::now();
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) /
+        static_cast<double>(calls);
+}
+
+double measure_generation(consolix::LoopWakeService& service, long long calls) {
+    std::uint64_t sum = 0;
+    const auto begin = Clock::now();
+    for (long long i = 0; i < calls; ++i) {
+        sum += service.generation();
+    }
+    const auto end = Clock::now();
+    generation_sink = sum;
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) /
+        static_cast<double>(calls);
+}
+
+/// \brief Wakes a parked waiter `rounds` times and records the time until it runs.
+std::vector<double> measure_wake_latency(int rounds) {
+    consolix::LoopWakeService service;
+    std::atomic<std::int64_t> woken_at(0);
+    std::atomic<bool> parked(false);
+    std::atomic<bool> done(false);
+
+    std::thread waiter([&]() {
+        consolix::LoopWakeService::Generation observed = service.generation();
+        while (!done.load()) {
+            parked.store(true);
+            if (service.wait_for_change(observed, std::chrono::milliseconds(1000))) {
+                woken_at.store(Clock::now().time_since_epoch().count());
+            }
+        }
+    });
+
+    std::vector<double> samples;
+    samples.reserve(static_cast<std::size_t>(rounds));
+    for (int i = 0; i < rounds; ++i) {
+        while (!parked.exchange(false)) {
+            std::this_thread::yield();
+        }
+        // Give the waiter time to reach the blocking wait.
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        woken_at.store(0);
+        const std::int64_t sent = Clock::now().time_since_epoch().count();
+        service.wake_all();
+        std::int64_t received = 0;
+        while ((received = woken_at.load()) == 0) {
+        }
+        samples.push_back(static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::duration(received - sent)).count()) / 1000.0);
+    }
+
+    done.store(true);
+    service.wake_all();
+    waiter.join();
+    std::sort(samples.begin(), samples.end());
+    return samples;
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    const std::size_t index = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const long long calls = argc > 1 ? std::atoll(argv[1]) : 50000000;
+    const int rounds = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+    consolix::LoopWakeService service;
+    std::cout << "LoopWakeService, uncontended" << std::endl;
+    std::cout << std::setw(28) << std::left << "operation" << std::setw(14) << std::right << "ns/op" << std::endl;
+    std::cout << std::setw(28) << std::left << "wake_all()" << std::setw(14) << std::right
+              << std::fixed << std::setprecision(2) << measure_wake_all(service, calls) << std::endl;
+    std::cout << std::setw(28) << std::left << "wake(channel)" << std::setw(14) << std::right
+              << measure_channel_wake(service, calls) << std::endl;
+    std::cout << std::setw(28) << std::left << "generation()" << std::setw(14) << std::right
+              << measure_generation(service, calls) << std::endl;
+
+    const std::vector<double> latency = measure_wake_latency(rounds);
+    std::cout << std::endl << "Wake-to-run latency, " << rounds << " rounds (us)" << std::endl;
+    std::cout << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99"
+              << std::setw(10) << "max" << std::endl;
+    std::cout << std::setw(10) << percentile(latency, 0.50) << std::setw(10) << percentile(latency, 0.90)
+              << std::setw(10) << percentile(latency, 0.99) << std::setw(10) << latency.back() << std::endl;
+    return 0;
+}
@@ -0,0 +1,114 @@
+/// \file bench_service_locator_contention.cpp
+/// \brief Compares locked map lookups with frozen snapshot lookups under reader contention.
+///
+/// Usage: `bench_service_locator_contention [iterations_per_thread]`
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+template <int Id>
+struct BenchService {
+    int value = Id;
+};
+
+void register_services() {
+    auto& locator = consolix::ServiceLocator::get_instance();
+    locator.register_service<BenchService<0>>();
+    locator.register_service<BenchService<1>>();
+    locator.register_service<BenchService<2>>();
+    locator.register_service<BenchService<3>>();
+    locator.register_service<BenchService<4>>();
+    locator.register_service<BenchService<5>>();
+    locator.register_service<BenchService<6>>();
+    locator.register_service<BenchService<7>>();
+}
+
+long long lookup_batch(consolix::ServiceLocator& locator) {
+    return locator.get_service<BenchService<0>>().value +
+           locator.get_service<BenchService<3>>().value +
+           locator.get_service<BenchService<5>>().value +
+           locator.get_service<BenchService<7>>().value;
+}
+
+double run_readers(unsigned thread_count, long long iterations) {
+    auto& locator = consolix::ServiceLocator::get_instance();
+    std::atomic<unsigned> ready(0);
+    std::atomic<bool> start(false);
+    std::atomic<long long> sink(0);
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < thread_count; ++i) {
+        threads.push_back(std::thread([&]() {
+            ready.fetch_add(1);
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+
+            long long local = 0;
+            for (long long j = 0; j < iterations; ++j) {
+                local += lookup_batch(locator);
+            }
+            sink.fetch_add(local);
+        }));
+    }
+
+    while (ready.load() != thread_count) {
+        std::this_thread::yield();
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    if (sink.load() == 0) {
+        std::cerr << "unexpected lookup result" << std::endl;
+    }
+
+    const double total_lookups = static_cast<double>(iterations) * 4.0 * thread_count;
+    const double elapsed_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    return elapsed_ns / total_lookups;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const long long iterations = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    const unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    register_services();
+    auto& locator = consolix::ServiceLocator::get_instance();
+
+    std::cout << "ServiceLocator lookup cost, ns per get_service() call" << std::endl;
+    std::cout << std::setw(8) << "threads"
+              << std::setw(14) << "locked map"
+              << std::setw(14) << "snapshot" << std::endl;
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        locator.unfreeze();
+        const double locked = run_readers(threads, iterations);
+
+        locator.freeze();
+        const double frozen = run_readers(threads, iterations);
+
+        std::cout << std::setw(8) << threads
+                  << std::setw(14) << std::fixed << std::setprecision(2) << locked
+                  << std::setw(14) << frozen << std::endl;
+    }
+
+    locator.clear_all();
+    return 0;
+}
@@ -0,0 +1,80 @@
+/// \file bench_timer_service.cpp
+/// \brief Measures `TimerService` schedule, cancel and expiry costs with many pending timers.
+///
+/// Usage: `bench_timer_service [timers]`
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+typedef consolix::TimerService::Clock Clock;
+
+double nanoseconds_per(Clock::duration elapsed, std::size_t operations) {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+        static_cast<double>(operations);
+}
+
+void print_row(const char* operation, double value) {
+    std::cout << std::setw(32) << std::left << operation << std::setw(14) << std::right
+              << std::fixed << std::setprecision(2) << value << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? static_cast<std::size_t>(std::atoll(argv[1])) : 100000;
+
+    consolix::TimerService timers;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> delays(1, 600000);
+    std::vector<std::chrono::milliseconds> schedule;
+    schedule.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        schedule.push_back(std::chrono::milliseconds(delays(random)));
+    }
+
+    std::uint64_t fired = 0;
+    std::vector<consolix::TimerService::TimerId> ids;
+    ids.reserve(count);
+    const Clock::time_point start = Clock::now();
+    Clock::time_point begin = Clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        ids.push_back(timers.schedule_after(schedule[i], [&fired]() { ++fired; }));
+    }
+    const double schedule_ns = nanoseconds_per(Clock::now() - begin, count);
+
+    begin = Clock::now();
+    for (std::size_t i = 0; i < count; i += 2) {
+        timers.cancel(ids[i]);
+    }
+    const double cancel_ns = nanoseconds_per(Clock::now() - begin, (count + 1) / 2);
+
+    // Reschedule the cancelled half so the free list is reused.
+    for (std::size_t i = 0; i < count; i += 2) {
+        timers.schedule_after(schedule[i], [&fired]() { ++fired; });
+    }
+
+    std::size_t advances = 0;
+    begin = Clock::now();
+    for (Clock::time_point now = start; fired < count; now += std::chrono::milliseconds(1)) {
+        timers.advance(now);
+        ++advances;
+    }
+    const Clock::duration expire_time = Clock::now() - begin;
+
+    std::cout << "TimerService, " << count << " timers over 10 minutes at 1 ms resolution" << std::endl;
+    std::cout << std::setw(32) << std::left << "operation" << std::setw(14) << std::right << "ns/op" << std::endl;
+    print_row("schedule_after()", schedule_ns);
+    print_row("cancel()", cancel_ns);
+    print_row("advance() per expired timer", nanoseconds_per(expire_time, count));
+    print_row("advance() per 1 ms tick", nanoseconds_per(expire_time, advances));
+    return 0;
+}
@@ -31,7 +31,7 @@
 /// - **ConfigComponent**: Loads and manages configuration from JSON files.
 /// - **BaseLoopComponent**: A base class for loop-based components.
 /// - **LoopComponent**: A component with customizable execution loops.
-/// - **LoopThrottleComponent**: A wakeable wait step for throttling polling loops.
+/// - **LoopThrottleComponent**: A wakeable wait step for throttling polling loops or pacing them at a fixed rate.
 /// - **PosixSignalWakeComponent**: Optional POSIX signal wake bridge for throttled loops.
 /// - **EventHubComponent**: Optional bridge to event-hub-cpp EventBus and TaskManager.
 /// - **ModuleHubComponent**: Optional bridge to event-hub-cpp ModuleHub.
@@ -100,6 +100,7 @@
 
 // Service management utilities required by LoggerComponent, CliComponent, ConfigComponent
 #include "core/ServiceLocator.hpp"          ///< Service locator for managing shared resources.
+#include "core/ServiceRef.hpp"              ///< Cached service handles for hot loops.
 #include "core/service_utils.hpp"           ///< Utility functions for working with services.
 #include "core/LoopWakeService.hpp"         ///< Shared wake channel for polling-loop waits.
 #include "core/PosixSignalWakeService.hpp"  ///< Optional self-pipe bridge for POSIX signal wake-ups.
@@ -19,7 +19,7 @@ namespace consolix {
     ///
     /// This component leverages the `cxxopts` library to parse command-line arguments
     /// and integrates with the service locator pattern to provide global access to parsed options.
-    class CliComponent : public IAppComponent {
+    class CliComponent : public IAppComponent, public IInitDependencies {
     public:
 
         /// \brief Constructs a `CliComponent` with automatic service registration.
@@ -68,6 +68,12 @@ namespace consolix {
             store_argv(argc, argv);
         }
 
+        /// \brief Declares the parsed arguments as a service provided during initialization.
+        /// \return Type index of `CliArguments`.
+        std::vector<std::type_index> provided_services() const override {
+            return type_indices<CliArguments>();
+        }
+
         /// \brief Adds a command-line option without a default value.
         /// \tparam T The type of the option value.
         /// \param key The option key.
@@ -25,7 +25,7 @@ namespace consolix {
     /// global access to the configuration data.
     /// \tparam ConfigType The type of the configuration structure.
     template <typename ConfigType>
-    class ConfigComponent : public IAppComponent {
+    class ConfigComponent : public IAppComponent, public IInitDependencies {
     public:
         /// \brief Constructs the `ConfigComponent`.
         /// \param default_file The default file path for the configuration.
@@ -36,6 +36,16 @@ namespace consolix {
             : m_default_file(default_file), m_cli_flag(cli_flag) {
         }
 
+        /// \brief Declares parsed CLI arguments as an initialization dependency.
+        /// \return Type index of `CliArguments` when cxxopts support is enabled.
+        std::vector<std::type_index> required_services() const override {
+#           if CONSOLIX_USE_CXXOPTS == 1
+            return type_indices<CliArguments>();
+#           else
+            return std::vector<std::type_index>();
+#           endif
+        }
+
         /// \brief Reloads the configuration from the file.
         void reload() {
             load_config();
@@ -22,7 +22,8 @@ namespace consolix {
     /// invokes the component's `process()` method.
     class EventHubComponent :
         public IAppComponent,
-        public IShutdownable {
+        public IShutdownable,
+        public IWorkReporter {
     public:
         /// \brief Default maximum number of tasks processed per loop pass.
         static constexpr std::size_t default_max_tasks_per_pass = 128;
@@ -63,7 +64,7 @@ namespace consolix {
 
         /// \brief Returns total work units processed by the last pass.
         /// \return Number of processed events and tasks.
-        std::size_t last_work_count() const {
+        std::size_t last_work_count() const override {
             return m_last_work_count;
         }
 
@@ -145,6 +145,7 @@
 #define CONSOLIX_SET_DEBUG_MODE(mode) \
     LOGIT_SET_LOGGER_ENABLED(CONSOLIX_LOGIT_DEBUG_INDEX, mode)
 
+#include <chrono>
 #include <logit.hpp>
 #include "LoggerComponent/MultiStream.hpp"
 
@@ -175,6 +176,19 @@ namespace consolix {
         /// \brief Virtual destructor.
         virtual ~LoggerComponent() = default;
 
+        /// \brief Logs a per-component timing summary of `manager` every `interval`.
+        ///
+        /// The summary lists call counts and `process()` latency percentiles taken from
+        /// `IComponentManager::component_stats()`, which is empty unless
+        /// `CONSOLIX_COMPONENT_STATS` is `1`. The manager must outlive this component.
+        /// \param manager Manager whose statistics are logged.
+        /// \param interval Time between summaries.
+        void log_component_stats(const IComponentManager& manager, std::chrono::milliseconds interval) {
+            m_stats_manager = &manager;
+            m_stats_interval = interval;
+            m_next_stats_log = std::chrono::steady_clock::now() + interval;
+        }
+
     protected:
 
         /// \brief Initializes the logging component.
@@ -201,12 +215,30 @@ namespace consolix {
             return m_is_init;
         }
 
-        /// \brief Executes the main functionality (no-op for LoggerComponent).
-        void process() override {}
+        /// \brief Logs the component timing summary when one is due.
+        void process() override {
+            if (!m_stats_manager) return;
+            const auto now = std::chrono::steady_clock::now();
+            if (now < m_next_stats_log) return;
+            m_next_stats_log = now + m_stats_interval;
+            for (const auto& stats : m_stats_manager->component_stats()) {
+                if (stats.process.count() == 0) continue;
+                LOGIT_PRINT_INFO(
+                    "Component [", stats.index, "] ", stats.name,
+                    ": calls=", stats.process.count(),
+                    " mean=", stats.process.mean(),
+                    "ns p50=", stats.process.percentile(0.5),
+                    "ns p99=", stats.process.percentile(0.99),
+                    "ns max=", stats.process.max(), "ns");
+            }
+        }
 
     private:
         std::string       m_debug_pattern;  ///< Pattern for debug log messages.
         std::atomic<bool> m_is_init{false}; ///< Indicates whether the component is initialized.
+        const IComponentManager*              m_stats_manager{nullptr}; ///< Source of the timing summary.
+        std::chrono::milliseconds             m_stats_interval{0};      ///< Time between summaries.
+        std::chrono::steady_clock::time_point m_next_stats_log{};       ///< Time of the next summary.
 
         /// \brief Initializes the logging system.
         /// \param console_pattern The log pattern for console output.
@@ -264,6 +296,7 @@ namespace consolix {
 
 #else // Fallback for when LogIt is not enabled
 
+#include <chrono>
 #include "LoggerComponent/MultiStream.hpp"
 
 /// \brief Fallback for general logging.
@@ -298,6 +331,9 @@ namespace consolix {
         LoggerComponent() = default;
         virtual ~LoggerComponent() = default;
 
+        /// \brief No-op without LogIt; kept for API compatibility.
+        void log_component_stats(const IComponentManager&, std::chrono::milliseconds) {}
+
     protected:
 
         bool initialize() override {return true;}
@@ -9,6 +9,7 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 
@@ -24,20 +25,52 @@ namespace consolix {
     /// Another thread can call `wake()` to end the wait early when new work arrives.
     /// When a `ConsoleApplicationRunner` is active, ordinary stop requests also
     /// wake this component through `LoopWakeService`.
+    ///
+    /// The loop thread reaches `LoopWakeService` through a `ServiceRef`, so a
+    /// process pass does not lock or copy a shared pointer to find it. `wake()` and
+    /// `set_delay()` use the locator that was current when the component was
+    /// initialized, so producer threads reach the right runner in sharded setups.
+    ///
+    /// By default each pass waits `delay()` after the pass's work, so the loop period
+    /// is the delay plus the work time. `set_fixed_rate()` instead ties passes to
+    /// absolute deadlines `start + n * period`, so work time and wake-up latency do
+    /// not accumulate into drift. A tick that starts a full period or more late is an
+    /// overrun, handled by the `CatchUp` policy; `tick_stats()` reports the lateness.
     class LoopThrottleComponent : public IAppComponent {
     public:
+        typedef std::chrono::steady_clock Clock;
+
+        /// \brief What a fixed-rate throttle does after falling behind by whole periods.
+        enum class CatchUp {
+            Skip,   ///< Drops the missed ticks and stays on the original grid.
+            Burst,  ///< Runs the missed ticks back to back until it is on time again.
+            Stretch ///< Drops the missed ticks and restarts the grid from the late tick.
+        };
+
+        /// \brief Counters of a fixed-rate throttle.
+        struct TickStats {
+            std::uint64_t    ticks{0};        ///< Ticks that released a pass.
+            std::uint64_t    overruns{0};     ///< Ticks released a full period or more late.
+            std::uint64_t    missed_ticks{0}; ///< Ticks dropped by `Skip` or `Stretch`.
+            LatencyHistogram lateness;        ///< Delay between each deadline and its release.
+        };
+
         /// \brief Constructs a throttle component with a short default delay.
         LoopThrottleComponent() = default;
 
         /// \brief Constructs a throttle component with a custom delay.
         /// \param delay Maximum time to wait during each process pass.
-        explicit LoopThrottleComponent(std::chrono::milliseconds delay) :
+        explicit LoopThrottleComponent(std::chrono::nanoseconds delay) :
             m_delay(delay) {
         }
 
         /// \brief Virtual destructor.
         virtual ~LoopThrottleComponent() override {
-            wake();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_wake_requested = true;
+            }
+            m_condition.notify_all();
         }
 
         /// \brief Wakes the component if it is currently waiting.
@@ -46,7 +79,7 @@ namespace consolix {
         /// the next process pass, so producer threads can signal work without racing
         /// the exact wait window.
         void wake() {
-            auto service = loop_wake_service();
+            auto service = service_locator().find_service<LoopWakeService>();
 
             {
                 std::lock_guard<std::mutex> lock(m_mutex);
@@ -60,8 +93,8 @@ namespace consolix {
 
         /// \brief Changes the throttle delay and wakes any active wait.
         /// \param delay New maximum wait duration per process pass.
-        void set_delay(std::chrono::milliseconds delay) {
-            auto service = loop_wake_service();
+        void set_delay(std::chrono::nanoseconds delay) {
+            auto service = service_locator().find_service<LoopWakeService>();
 
             {
                 std::lock_guard<std::mutex> lock(m_mutex);
@@ -74,16 +107,75 @@ namespace consolix {
             m_condition.notify_all();
         }
 
-        /// \brief Returns the currently configured throttle delay.
-        /// \return Maximum wait duration per process pass.
+        /// \brief Returns the currently configured throttle delay in whole milliseconds.
+        /// \return Maximum wait duration per process pass, truncated; see `delay_ns()`.
         std::chrono::milliseconds delay() const {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(delay_ns());
+        }
+
+        /// \brief Returns the currently configured throttle delay with full resolution.
+        /// \return Maximum wait duration per process pass.
+        std::chrono::nanoseconds delay_ns() const {
             std::lock_guard<std::mutex> lock(m_mutex);
             return m_delay;
         }
 
+        /// \brief Releases passes at a fixed rate instead of waiting `delay()` after each one.
+        ///
+        /// The first deadline is one period after the next pass starts. `wake()` still
+        /// ends a wait early, but the deadlines stay where they are. Statistics are reset.
+        /// \param period Time between ticks; non-positive values return to the delay mode.
+        /// \param catch_up Policy for ticks missed by a full period or more.
+        void set_fixed_rate(std::chrono::nanoseconds period, CatchUp catch_up = CatchUp::Skip) {
+            auto service = service_locator().find_service<LoopWakeService>();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_period = period > std::chrono::nanoseconds::zero() ? period : std::chrono::nanoseconds::zero();
+                m_catch_up = catch_up;
+                m_restart = true;
+                m_stats = TickStats();
+                m_wake_requested = true;
+            }
+            if (service) {
+                service->wake_all();
+            }
+            m_condition.notify_all();
+        }
+
+        /// \brief Returns the fixed-rate period, or zero in the delay mode.
+        std::chrono::nanoseconds fixed_rate() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_period;
+        }
+
+        /// \brief Ends each wait with a calibrated spin instead of a kernel wake-up.
+        ///
+        /// Kernel wake-ups arrive tens of microseconds late, which dominates delays and
+        /// periods of 50-200 us. With hybrid waiting the throttle sleeps until shortly
+        /// before the deadline and spins for the rest (see `HybridSleeper`), trading at
+        /// most `CONSOLIX_HYBRID_SLEEP_MAX_SPIN_US` of CPU per wait for accuracy.
+        void set_hybrid_wait(bool enabled) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_hybrid_wait = enabled;
+        }
+
+        /// \brief Returns whether waits end with a calibrated spin.
+        bool hybrid_wait() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_hybrid_wait;
+        }
+
+        /// \brief Returns a copy of the fixed-rate tick statistics.
+        TickStats tick_stats() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_stats;
+        }
+
     protected:
         bool initialize() override {
-            if (auto service = loop_wake_service()) {
+            m_locator.store(&ServiceLocator::current());
+            if (LoopWakeService* service = m_loop_wake_service.get()) {
                 m_observed_generation = service->generation();
             }
             m_is_initialized.store(true);
@@ -95,63 +187,134 @@ namespace consolix {
         }
 
         void process() override {
-            std::chrono::milliseconds current_delay;
+            std::chrono::nanoseconds current_delay;
+            std::chrono::nanoseconds period;
+            bool hybrid = false;
             {
                 std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_restart) {
+                    m_restart = false;
+                    m_next_tick = Clock::now() + m_period;
+                }
                 if (m_wake_requested) {
                     m_wake_requested = false;
                     return;
                 }
 
                 current_delay = m_delay;
+                period = m_period;
+                hybrid = m_hybrid_wait;
             }
 
-            if (current_delay <= std::chrono::milliseconds(0)) {
+            if (period > std::chrono::nanoseconds::zero()) {
+                if (Clock::now() >= m_next_tick || wait_until(m_next_tick, hybrid)) {
+                    release_tick(period);
+                }
                 return;
             }
 
-            if (auto service = loop_wake_service()) {
-                service->wait_for_change(m_observed_generation, current_delay);
-                std::lock_guard<std::mutex> lock(m_mutex);
-                m_wake_requested = false;
+            if (current_delay <= std::chrono::nanoseconds::zero()) {
                 return;
             }
 
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_condition.wait_for(
-                lock,
-                current_delay,
-                [this]() {
-                    return m_wake_requested;
-                });
-            m_wake_requested = false;
+            wait_until(Clock::now() + current_delay, hybrid);
         }
 
     private:
-        std::shared_ptr<LoopWakeService> loop_wake_service() {
-            {
-                std::lock_guard<std::mutex> lock(m_mutex);
-                auto service = m_loop_wake_service.lock();
-                if (service) {
-                    return service;
+        mutable std::mutex          m_mutex;
+        std::condition_variable     m_condition;
+        std::chrono::nanoseconds    m_delay{std::chrono::milliseconds(1)};
+        std::chrono::nanoseconds    m_period{0};     ///< Fixed-rate period; zero in the delay mode.
+        CatchUp                     m_catch_up{CatchUp::Skip};
+        bool                        m_restart{false}; ///< Restart the grid on the next pass.
+        Clock::time_point           m_next_tick{};    ///< Next fixed-rate deadline; loop thread only.
+        TickStats                   m_stats;
+        bool                        m_hybrid_wait{false};
+        HybridSleeper               m_sleeper;        ///< Calibrated for the loop thread.
+        bool                        m_wake_requested{false};
+        std::atomic<bool>           m_is_initialized{false};
+        ServiceRef<LoopWakeService> m_loop_wake_service; ///< Loop-thread handle; not used by `wake()`.
+        LoopWakeService::Generation m_observed_generation{0};
+        std::atomic<ServiceLocator*> m_locator{nullptr}; ///< Locator captured by `initialize()`.
+
+        /// \brief Waits until `deadline` unless woken first.
+        /// \return `true` if the deadline was reached.
+        bool wait_until(Clock::time_point deadline, bool hybrid) {
+            if (LoopWakeService* service = m_loop_wake_service.get()) {
+                if (hybrid) {
+                    service->wait_until_change(m_observed_generation, deadline, m_sleeper);
+                } else {
+                    service->wait_until_change(m_observed_generation, deadline);
                 }
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_wake_requested = false;
+                return Clock::now() >= deadline;
             }
 
-            auto service = ServiceLocator::get_instance().find_service<LoopWakeService>();
-            if (service) {
-                std::lock_guard<std::mutex> lock(m_mutex);
-                m_loop_wake_service = service;
+            if (hybrid) {
+                m_sleeper.wait_until(
+                    deadline,
+                    [this](Clock::time_point coarse_deadline) {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        return m_condition.wait_until(
+                            lock,
+                            coarse_deadline,
+                            [this]() {
+                                return m_wake_requested;
+                            });
+                    },
+                    [this]() {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        return m_wake_requested;
+                    });
+            } else {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait_until(
+                    lock,
+                    deadline,
+                    [this]() {
+                        return m_wake_requested;
+                    });
             }
-            return service;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wake_requested = false;
+            return Clock::now() >= deadline;
         }
 
-        mutable std::mutex          m_mutex;
-        std::condition_variable     m_condition;
-        std::chrono::milliseconds   m_delay{std::chrono::milliseconds(1)};
-        bool                        m_wake_requested{false};
-        std::atomic<bool>           m_is_initialized{false};
-        std::weak_ptr<LoopWakeService> m_loop_wake_service;
-        LoopWakeService::Generation m_observed_generation{0};
+        /// \brief Records the tick due at `m_next_tick` and moves to the next deadline.
+        void release_tick(std::chrono::nanoseconds period) {
+            const Clock::time_point now = Clock::now();
+            const std::chrono::nanoseconds lateness =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_next_tick);
+            const std::uint64_t missed = static_cast<std::uint64_t>(lateness / period);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_stats.ticks;
+            m_stats.lateness.record(static_cast<std::uint64_t>(lateness.count()));
+            if (missed == 0) {
+                m_next_tick += period;
+                return;
+            }
+            ++m_stats.overruns;
+            switch (m_catch_up) {
+            case CatchUp::Skip:
+                m_stats.missed_ticks += missed;
+                m_next_tick += period * static_cast<std::chrono::nanoseconds::rep>(missed + 1);
+                break;
+            case CatchUp::Burst:
+                m_next_tick += period;
+                break;
+            case CatchUp::Stretch:
+                m_stats.missed_ticks += missed;
+                m_next_tick = now + period;
+                break;
+            }
+        }
+
+        ServiceLocator& service_locator() const {
+            ServiceLocator* locator = m_locator.load();
+            return locator ? *locator : ServiceLocator::current();
+        }
     }; // LoopThrottleComponent
 
 } // namespace consolix
@@ -22,7 +22,8 @@ namespace consolix {
     /// while it is processed by Consolix.
     class ModuleHubComponent :
         public IAppComponent,
-        public IShutdownable {
+        public IShutdownable,
+        public IWorkReporter {
     public:
         /// \brief Constructs an empty component.
         ModuleHubComponent() = default;
@@ -41,7 +42,7 @@ namespace consolix {
 
         /// \brief Returns work units processed by the last pass.
         /// \return Number of processed events, tasks, and module hooks.
-        std::size_t last_work_count() const {
+        std::size_t last_work_count() const override {
             return m_last_work_count;
         }
 
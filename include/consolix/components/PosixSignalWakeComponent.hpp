@@ -32,10 +32,11 @@ namespace consolix {
                 return true;
             }
 
-            auto service = ServiceLocator::get_instance().find_service<PosixSignalWakeService>();
+            ServiceLocator& locator = ServiceLocator::current();
+            auto service = locator.find_service<PosixSignalWakeService>();
             if (!service) {
-                ServiceLocator::get_instance().register_service<PosixSignalWakeService>();
-                service = ServiceLocator::get_instance().find_service<PosixSignalWakeService>();
+                locator.register_service<PosixSignalWakeService>();
+                service = locator.find_service<PosixSignalWakeService>();
             }
 
             if (service) {
@@ -146,4 +146,81 @@
 #define CONSOLIX_FORCED_SHUTDOWN_TIMEOUT_MS 4000
 #endif
 
+/// \def CONSOLIX_COMPONENT_STATS
+/// \brief Enables per-component timing histograms in `AppComponentManager`.
+/// \details When set to `1`, every `process()` and `initialize()` call is timed into
+/// per-thread `LatencyHistogram`s readable through `component_stats()`. When `0`, the
+/// timing code is compiled out and `component_stats()` returns an empty list.
+/// \default `0`
+#ifndef CONSOLIX_COMPONENT_STATS
+#define CONSOLIX_COMPONENT_STATS 0
+#endif
+
+/// \def CONSOLIX_WAKE_CHANNEL_LIMIT
+/// \brief Number of targeted wake channels each `LoopWakeService` provides.
+/// \details Channel state is a fixed array so that `wake(channel)` never locks;
+/// `LoopWakeService::channel()` throws once all channels are named.
+/// \default `32`
+#ifndef CONSOLIX_WAKE_CHANNEL_LIMIT
+#define CONSOLIX_WAKE_CHANNEL_LIMIT 32
+#endif
+
+/// \def CONSOLIX_SHUTDOWN_TIMEOUT_EXIT_CODE
+/// \brief Exit code returned by the runner when component shutdown overran a deadline.
+/// \details Applies only when the run would otherwise exit with `0`; signal and error
+/// codes are kept. Deadlines come from `AppComponentManager::set_shutdown_policy()`.
+/// \default `124`
+#ifndef CONSOLIX_SHUTDOWN_TIMEOUT_EXIT_CODE
+#define CONSOLIX_SHUTDOWN_TIMEOUT_EXIT_CODE 124
+#endif
+
+/// \def CONSOLIX_INIT_POLL_INTERVAL_MS
+/// \brief Maximum time the runner waits between component initialization passes.
+/// \details Components that are not ready yet are polled again after this interval,
+/// or immediately when `LoopWakeService` is woken (see `consolix::wake_loop()`).
+/// \default `1`
+#ifndef CONSOLIX_INIT_POLL_INTERVAL_MS
+#define CONSOLIX_INIT_POLL_INTERVAL_MS 1
+#endif
+
+/// \def CONSOLIX_SCHEDULE_MAX_WAIT_MS
+/// \brief Upper bound for a runner wait until the manager's next scheduled deadline.
+/// \details Bounds how long POSIX signal stop requests can go unnoticed when every
+/// component is on a period or on-wake schedule and no wake request arrives.
+/// \default `100`
+#ifndef CONSOLIX_SCHEDULE_MAX_WAIT_MS
+#define CONSOLIX_SCHEDULE_MAX_WAIT_MS 100
+#endif
+
+/// \def CONSOLIX_HYBRID_SLEEP_MAX_SPIN_US
+/// \brief Default upper bound, in microseconds, for the spin tail of a `HybridSleeper`.
+/// \details The sleeper calibrates its spin margin to the observed wake-up lateness
+/// and never spins longer than this.
+/// \default `100`
+#ifndef CONSOLIX_HYBRID_SLEEP_MAX_SPIN_US
+#define CONSOLIX_HYBRID_SLEEP_MAX_SPIN_US 100
+#endif
+
+/// \def CONSOLIX_REALTIME_PRIORITY
+/// \brief Default real-time priority of `RealtimePolicy::locked()`.
+/// \details Clamped to the range of the chosen scheduling class (1-99 on Linux).
+/// \default `50`
+#ifndef CONSOLIX_REALTIME_PRIORITY
+#define CONSOLIX_REALTIME_PRIORITY 50
+#endif
+
+/// \def CONSOLIX_REALTIME_STACK_PREFAULT_KB
+/// \brief Default stack depth, in KiB, that `RealtimePolicy::locked()` prefaults.
+/// \default `256`
+#ifndef CONSOLIX_REALTIME_STACK_PREFAULT_KB
+#define CONSOLIX_REALTIME_STACK_PREFAULT_KB 256
+#endif
+
+/// \def CONSOLIX_REALTIME_HEAP_PREFAULT_KB
+/// \brief Default heap size, in KiB, that `RealtimePolicy::locked()` prefaults.
+/// \default `8192`
+#ifndef CONSOLIX_REALTIME_HEAP_PREFAULT_KB
+#define CONSOLIX_REALTIME_HEAP_PREFAULT_KB 8192
+#endif
+
 #endif // _CONSOLIX_CONFIG_MACROS_HPP_INCLUDED
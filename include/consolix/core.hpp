@@ -17,11 +17,25 @@
 /// global services, and component interaction.
 ///
 /// ### Main Components:
-/// - **ServiceLocator**: A mechanism for registering and accessing global services.
+/// - **ServiceLocator**: A mechanism for registering and accessing global or scoped services.
+/// - **ServiceRef**: A cached service handle for hot loops.
 /// - **AppComponentManager**: A manager for handling application components.
+/// - **ShutdownPolicy**: Deadlines and parallelism for component shutdown.
+/// - **ComponentSchedule**: Per-component cadence for `AppComponentManager::process()`.
+/// - **LatencyHistogram**: Log-linear histograms behind `CONSOLIX_COMPONENT_STATS`.
+/// - **ForkJoinPool**: A bounded pool used for parallel component initialization.
+/// - **CpuTopology**: Cores, SMT siblings, caches and NUMA nodes read from sysfs.
+/// - **ThreadPlacement**: Declarative pinning and naming of the threads Consolix creates.
+/// - **StaticComponentManager**: A compile-time manager for a fixed set of components.
 /// - **ConsoleApplication**: A singleton for managing the console application. It includes `AppComponentManager`.
+/// - **PreciseSleep**: Absolute-deadline sleeps and a calibrated sleep-then-spin `HybridSleeper`.
 /// - **LoopWakeService**: A shared wake channel for polling-loop wait components.
+/// - **IdlePolicy**: Adaptive spin, yield and park backoff for idle runner loops.
 /// - **PosixSignalWakeService**: An opt-in self-pipe bridge for POSIX signal wake-ups.
+/// - **Reactor**: An epoll demultiplexer for descriptors and timers used by the runner's reactor mode (Linux).
+/// - **SignalFdService**: Synchronous signal delivery through a `signalfd` for reactor mode (Linux).
+/// - **TimerService**: A hierarchical timing wheel whose callbacks run on the runner's loop thread.
+/// - **RealtimePolicy**: Opt-in real-time scheduling, memory locking and prefaulting for the loop thread.
 /// - **Utilities**: Functions to simplify working with applications and services.
 ///
 /// ### Key Features:
@@ -31,10 +45,24 @@
 ///
 /// ### Header Files:
 /// - `core/ServiceLocator.hpp`
+/// - `core/ServiceRef.hpp`
 /// - `core/service_utils.hpp`
+/// - `core/CpuTopology.hpp`
+/// - `core/ThreadPlacement.hpp`
+/// - `core/ForkJoinPool.hpp`
+/// - `core/ComponentSchedule.hpp`
+/// - `core/ComponentStats.hpp`
+/// - `core/ShutdownPolicy.hpp`
 /// - `core/AppComponentManager.hpp`
+/// - `core/StaticComponentManager.hpp`
+/// - `core/PreciseSleep.hpp`
 /// - `core/LoopWakeService.hpp`
+/// - `core/IdlePolicy.hpp`
 /// - `core/PosixSignalWakeService.hpp`
+/// - `core/Reactor.hpp`
+/// - `core/SignalFdService.hpp`
+/// - `core/TimerService.hpp`
+/// - `core/RealtimePolicy.hpp`
 /// - `core/ConsoleApplicationRunner.hpp`
 /// - `core/ConsoleApplication.hpp`
 /// - `core/application_utils.hpp`
@@ -77,10 +105,24 @@
 #include "components.hpp"               ///< Predefined application components.
 #include "core/platform_includes.hpp"   ///< Platform-specific includes and definitions.
 #include "core/ServiceLocator.hpp"      ///< Singleton for managing globally accessible services.
+#include "core/ServiceRef.hpp"          ///< Cached service handles for hot loops.
 #include "core/service_utils.hpp"       ///< Helper functions for working with services.
-#include "core/AppComponentManager.hpp" ///< Manager for application components and their lifecycle.
+#include "core/PreciseSleep.hpp"        ///< Absolute-deadline sleeps and hybrid sleep-then-spin waits.
 #include "core/LoopWakeService.hpp"     ///< Shared wake channel for polling-loop waits.
+#include "core/CpuTopology.hpp"         ///< CPU, cache and NUMA topology from sysfs.
+#include "core/ThreadPlacement.hpp"     ///< Pinning and naming of Consolix threads.
+#include "core/ForkJoinPool.hpp"        ///< Bounded pool for parallel component work.
+#include "core/ComponentSchedule.hpp"   ///< Per-component process cadence.
+#include "core/ComponentStats.hpp"      ///< Latency histograms for component timing.
+#include "core/ShutdownPolicy.hpp"   ///< Shutdown deadlines, parallelism and report.
+#include "core/AppComponentManager.hpp" ///< Manager for application components and their lifecycle.
+#include "core/StaticComponentManager.hpp" ///< Compile-time manager for a fixed component set.
+#include "core/IdlePolicy.hpp"       ///< Adaptive idle backoff for the runner loop.
 #include "core/PosixSignalWakeService.hpp" ///< Optional self-pipe bridge for POSIX signal wake-ups.
+#include "core/Reactor.hpp"          ///< epoll reactor for descriptor and timer driven loops (Linux).
+#include "core/SignalFdService.hpp"  ///< signalfd signal delivery without a watcher thread (Linux).
+#include "core/TimerService.hpp"     ///< Timing wheel for one-shot and periodic loop timers.
+#include "core/RealtimePolicy.hpp"   ///< Real-time scheduling and memory-locking setup and report.
 #include "core/ConsoleApplicationRunner.hpp" ///< Runner returning exit codes without std::exit.
 #include "core/ConsoleApplication.hpp"  ///< Singleton managing the console application's lifecycle.
 #include "core/application_utils.hpp"   ///< Helper functions for application setup and execution.
@@ -6,6 +6,22 @@
 /// \brief Manages application components with lifecycle support.
 /// \ingroup Core
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace consolix {
@@ -15,21 +31,55 @@ namespace consolix {
     ///
     /// The manager provides controlled initialization, execution, and shutdown for all
     /// registered components. It ensures:
-    /// - `initialize()`: Prepares each component for execution.
-    /// - `process()`: Executes the main loop logic for each component.
+    /// - `initialize()`: Prepares each component for execution. Components that reported
+    ///   ready are not polled again; each call only revisits the pending ones.
+    /// - `process()`: Executes the main loop logic for each component. With
+    ///   `set_processing_threads()`, consecutive components implementing `IParallelProcess`
+    ///   run as one parallel stage that ends at a join barrier.
     /// - `shutdown(signal)`: Implements a "soft shutdown" by continuing to shut down other
     ///   components even if one fails, and logs aggregated errors if any occur.
     ///
     /// Components are stored as `std::shared_ptr` for memory safety and compatibility with
-    /// the `ServiceLocator` pattern.
-    class AppComponentManager {
+    /// the `ServiceLocator` pattern. `add()` resolves the optional interfaces a component
+    /// implements once and keeps the resulting pointers and capability flags in one
+    /// contiguous component table, so lifecycle paths dispatch without RTTI casts.
+    ///
+    /// With `set_initialization_threads()`, components implementing `IInitDependencies`
+    /// are initialized in dependency waves on a bounded `ForkJoinPool`. Components
+    /// without declared dependencies act as sequential barriers, and when several
+    /// components of one wave fail, the error of the earliest registered one is rethrown.
+    ///
+    /// `set_schedule()` gives a component its own cadence (see `ComponentSchedule`).
+    /// Passes skip components that are not due, and `next_deadline()` tells the runner
+    /// how long it may wait before the next pass has work.
+    ///
+    /// `add()` and `set_schedule()` are meant for setup, before the loop runs. While the loop
+    /// runs, `add_deferred()` and `remove_deferred()` may be called from any thread: the
+    /// changes are queued and applied by the loop thread at the start of the next pass.
+    /// Added components are initialized there and join the table once ready; removed
+    /// components are shut down and dropped.
+    ///
+    /// Each manager is bound to a `ServiceLocator`; `initialize()` and `shutdown()` make it
+    /// the current locator of the calling thread, so independent managers can run in
+    /// one process without sharing services.
+    class AppComponentManager : public IComponentManager {
     public:
 
-        /// \brief Constructs an empty component manager.
-        AppComponentManager() = default;
+        /// \brief Constructs an empty component manager bound to the global locator.
+        AppComponentManager() :
+            m_locator(&ServiceLocator::get_instance()),
+            m_wake_service(*m_locator) {
+        }
+
+        /// \brief Constructs an empty component manager bound to a specific locator.
+        /// \param locator Locator that must outlive the manager.
+        explicit AppComponentManager(ServiceLocator& locator) :
+            m_locator(&locator),
+            m_wake_service(locator) {
+        }
 
         /// \brief Destroys the component manager and clears all components.
-        ~AppComponentManager() {
+        ~AppComponentManager() override {
             m_components.clear(); // Ensures the container is empty.
         }
 
@@ -43,53 +93,186 @@ namespace consolix {
         template <typename Component, typename... Args>
         std::shared_ptr<Component> add(Args&&... args) {
             auto ptr = std::make_shared<Component>(std::forward<Args>(args)...);
-            m_components.push_back(ptr);
+            add(std::shared_ptr<IAppComponent>(ptr));
             return ptr;
         }
 
         /// \brief Adds an existing component to the manager.
         /// \param component A `std::shared_ptr` to the component to add.
         void add(std::shared_ptr<IAppComponent> component) {
-            m_components.push_back(std::move(component));
+            append_component(std::move(component));
+            m_pending.push_back(m_components.size() - 1);
+        }
+
+        /// \brief Constructs a component and queues it to join the running loop.
+        /// \tparam Component The type of the component to create.
+        /// \tparam Args Argument types for the component's constructor.
+        /// \param args Arguments for constructing the component.
+        /// \return A shared pointer to the queued component.
+        template <typename Component, typename... Args>
+        std::shared_ptr<Component> add_deferred(Args&&... args) {
+            auto ptr = std::make_shared<Component>(std::forward<Args>(args)...);
+            add_deferred(std::shared_ptr<IAppComponent>(ptr));
+            return ptr;
+        }
+
+        /// \brief Queues a component to join the running loop; safe to call from any thread.
+        ///
+        /// At the start of the next pass the loop thread initializes the component and
+        /// appends it once `is_initialized()` reports ready, retrying on later passes until
+        /// then. A component whose `initialize()` throws is logged and discarded.
+        /// \param component The component to add.
+        void add_deferred(std::shared_ptr<IAppComponent> component) {
+            post_change(true, std::move(component));
+        }
+
+        /// \brief Queues a component for removal from the running loop; safe to call from any thread.
+        ///
+        /// At the start of the next pass the loop thread shuts the component down (if it
+        /// implements `IShutdownable`, with signal `0`) and drops it from the table.
+        /// A deferred component that is still initializing is shut down the same way;
+        /// one whose `initialize()` has not run yet is dropped. Unknown components are ignored.
+        /// \param component The component to remove.
+        void remove_deferred(std::shared_ptr<IAppComponent> component) {
+            post_change(false, std::move(component));
+        }
+
+        /// \brief Sets how often a managed component's `process()` runs.
+        /// \param component A component previously added to this manager.
+        /// \param schedule Cadence to apply from the next pass.
+        /// \throws std::invalid_argument If the component is not managed by this manager.
+        void set_schedule(const std::shared_ptr<IAppComponent>& component, ComponentSchedule schedule) {
+            for (std::size_t index = 0; index < m_components.size(); ++index) {
+                if (m_components[index].owner != component) continue;
+                ScheduleState& state = m_schedules[index];
+                if (state.schedule.mode() != ComponentSchedule::Mode::EveryIteration) --m_scheduled_count;
+                if (state.schedule.mode() == ComponentSchedule::Mode::OnWake) --m_on_wake_count;
+                state = ScheduleState();
+                state.schedule = schedule;
+                if (schedule.mode() != ComponentSchedule::Mode::EveryIteration) ++m_scheduled_count;
+                if (schedule.mode() == ComponentSchedule::Mode::OnWake) {
+                    ++m_on_wake_count;
+                    LoopWakeService* service = m_wake_service.get();
+                    state.wake_generation = service ? service->generation() : 0;
+                }
+                return;
+            }
+            throw std::invalid_argument("Component is not managed by this AppComponentManager");
+        }
+
+        /// \brief Sets the number of threads used to initialize components.
+        ///
+        /// Values above one enable parallel initialization of components implementing
+        /// `IInitDependencies`; `0` and `1` restore strictly sequential initialization.
+        /// \param thread_count Maximum number of threads, including the calling thread.
+        void set_initialization_threads(std::size_t thread_count) {
+            m_initialization_threads = thread_count;
+        }
+
+        /// \brief Returns the number of threads used to initialize components.
+        /// \return Configured thread count; `0` or `1` means sequential initialization.
+        std::size_t initialization_threads() const {
+            return m_initialization_threads;
+        }
+
+        /// \brief Sets the number of threads used by `process()`.
+        ///
+        /// Values above one run consecutive `IParallelProcess` components concurrently;
+        /// `0` and `1` restore strictly sequential processing.
+        /// \param thread_count Maximum number of threads, including the calling thread.
+        void set_processing_threads(std::size_t thread_count) {
+            m_processing_threads = thread_count;
+        }
+
+        /// \brief Returns the number of threads used by `process()`.
+        /// \return Configured thread count; `0` or `1` means sequential processing.
+        std::size_t processing_threads() const {
+            return m_processing_threads;
+        }
+
+        /// \brief Returns the locator the manager is bound to.
+        /// \return Reference to the bound locator.
+        ServiceLocator& service_locator() const override {
+            return *m_locator;
         }
 
         /// \brief Initializes all registered components.
         ///
-        /// Skips components that are already initialized.
+        /// Visits only components that have not reported ready yet, in registration order.
+        /// A component that reports ready is removed from the pending list.
         /// \return `true` if all components are initialized successfully, `false` otherwise.
         /// \throws std::exception If any component fails during initialization.
-        bool initialize() {
+        bool initialize() override {
+            ServiceLocator::Scope scope(*m_locator);
+            prepare_stats();
+            if (m_initialization_threads > 1) {
+                return initialize_parallel();
+            }
+
+            std::size_t kept = 0;
+            std::size_t index = 0;
             try {
-                for (const auto& component : m_components) {
-                    if (component->is_initialized()) continue;
-                    component->initialize();
+                for (; index < m_pending.size(); ++index) {
+                    IAppComponent* component = m_components[m_pending[index]].component;
+                    if (!component->is_initialized()) {
+                        initialize_component(m_pending[index]);
+                    }
+                    if (!component->is_initialized()) {
+                        m_pending[kept++] = m_pending[index];
+                    }
                 }
-                return is_initialized();
+                m_pending.resize(kept);
+                return m_pending.empty();
             } catch (const std::exception& e) {
+                m_pending.erase(m_pending.begin() + kept, m_pending.begin() + index);
 #               if CONSOLIX_USE_LOGIT == 1
                 LOGIT_PRINT_FATAL("Initialization error: ", e.what());
 #               endif
                 throw;
+            } catch (...) {
+                m_pending.erase(m_pending.begin() + kept, m_pending.begin() + index);
+                throw;
             }
         }
 
         /// \brief Checks if all components are initialized.
         /// \return `true` if all components are initialized, `false` otherwise.
-        bool is_initialized() const {
-            for (const auto& component : m_components) {
-                if (!component->is_initialized()) return false;
+        bool is_initialized() const override {
+            for (std::size_t index : m_pending) {
+                if (!m_components[index].component->is_initialized()) return false;
             }
             return true;
         }
 
         /// \brief Executes the main functionality of all components.
         ///
-        /// Calls `process()` on each managed component.
+        /// Calls `process()` on each managed component. In parallel mode, a failing stage
+        /// still completes, the exception of its earliest registered component is rethrown,
+        /// and later stages are skipped.
         /// \throws std::exception If any component fails during execution.
-        void process() {
+        void process() override {
             try {
-                for (const auto& component : m_components) {
-                    component->process();
+                if (m_staged->pending.load(std::memory_order_acquire) || !m_incoming.empty()) {
+                    apply_deferred_changes();
+                }
+                prepare_stats();
+                if (m_scheduled_count != 0) {
+                    begin_scheduled_pass();
+                }
+                if (m_processing_threads > 1) {
+                    process_parallel();
+                    return;
+                }
+                if (m_scheduled_count != 0) {
+                    for (std::size_t index = 0; index < m_components.size(); ++index) {
+                        if (is_due(index)) {
+                            process_component(index);
+                        }
+                    }
+                    return;
+                }
+                for (std::size_t index = 0; index < m_components.size(); ++index) {
+                    process_component(index);
                 }
             } catch (const std::exception& e) {
 #               if CONSOLIX_USE_LOGIT == 1
@@ -99,42 +282,178 @@ namespace consolix {
             }
         }
 
+        /// \brief Checks whether any managed component implements `IWorkReporter`.
+        /// \return `true` if `last_work_count()` carries information.
+        bool reports_work() const override {
+            return m_reporter_count != 0;
+        }
+
+        /// \brief Returns the work reported by components that ran in the last pass.
+        ///
+        /// Reporters skipped by their schedule in the last pass do not contribute.
+        /// \return Sum of `IWorkReporter::last_work_count()` values.
+        std::size_t last_work_count() const override {
+            std::size_t total = 0;
+            if (m_reporter_count == 0) {
+                return 0;
+            }
+            for (std::size_t index = 0; index < m_components.size(); ++index) {
+                const ComponentEntry& entry = m_components[index];
+                if (entry.reporter && (m_scheduled_count == 0 || m_schedules[index].ran)) {
+                    total += entry.reporter->last_work_count();
+                }
+            }
+            return total;
+        }
+
+        /// \brief Passes a signal to every component implementing `ISignalSubscriber`.
+        ///
+        /// Subscribers are called in registration order on the calling thread.
+        /// \param signal_number Delivered signal number.
+        /// \return Number of components notified.
+        std::size_t dispatch_signal(int signal_number) override {
+            if (m_subscriber_count == 0) {
+                return 0;
+            }
+            std::size_t notified = 0;
+            for (std::size_t index = 0; index < m_components.size(); ++index) {
+                if (ISignalSubscriber* subscriber = m_components[index].subscriber) {
+                    subscriber->on_signal(signal_number);
+                    ++notified;
+                }
+            }
+            return notified;
+        }
+
+#       if CONSOLIX_COMPONENT_STATS == 1
+        /// \brief Returns merged timing statistics per component.
+        ///
+        /// Histograms are recorded per thread and merged here. Call this between passes
+        /// on the loop thread, for example from a component or the runner's iteration action.
+        /// \return One entry per component in registration order.
+        std::vector<ComponentStats> component_stats() const override {
+            std::vector<ComponentStats> result(m_components.size());
+            for (std::size_t index = 0; index < m_components.size(); ++index) {
+                result[index].index = index;
+                result[index].name = typeid(*m_components[index].component).name();
+                for (const auto& shard : m_stats) {
+                    if (index < shard.process.size()) {
+                        result[index].process.merge(shard.process[index]);
+                        result[index].initialize.merge(shard.initialize[index]);
+                    }
+                }
+            }
+            return result;
+        }
+#       endif
+
+        /// \brief Clears the timing statistics; a no-op when `CONSOLIX_COMPONENT_STATS` is `0`.
+        void reset_component_stats() {
+#           if CONSOLIX_COMPONENT_STATS == 1
+            for (auto& shard : m_stats) {
+                for (auto& histogram : shard.process) histogram.reset();
+                for (auto& histogram : shard.initialize) histogram.reset();
+            }
+#           endif
+        }
+
+        /// \brief Returns the earliest time at which a scheduled component becomes due.
+        ///
+        /// Components on the default schedule or on an iteration schedule keep the next
+        /// pass due immediately. Components that only run on wake requests add no deadline.
+        /// \return `time_point::min()` when the next pass is due immediately, or
+        ///         `time_point::max()` when only a wake request can make work due.
+        std::chrono::steady_clock::time_point next_deadline() const override {
+            typedef std::chrono::steady_clock::time_point TimePoint;
+            if (m_scheduled_count != m_components.size()) {
+                return TimePoint::min();
+            }
+            TimePoint deadline = TimePoint::max();
+            for (const auto& state : m_schedules) {
+                switch (state.schedule.mode()) {
+                case ComponentSchedule::Mode::Period:
+                    deadline = std::min(deadline, state.next_due);
+                    break;
+                case ComponentSchedule::Mode::OnWake:
+                    if (!state.primed) return TimePoint::min();
+                    break;
+                default:
+                    return TimePoint::min();
+                }
+            }
+            return deadline;
+        }
+
+        /// \brief Sets deadlines and parallelism for `shutdown()`.
+        /// \param policy Policy applied by the next `shutdown()` call.
+        void set_shutdown_policy(const ShutdownPolicy& policy) {
+            m_shutdown_policy = policy;
+        }
+
+        /// \brief Returns the shutdown policy.
+        const ShutdownPolicy& shutdown_policy() const {
+            return m_shutdown_policy;
+        }
+
+        /// \brief Returns timings of the last `shutdown()` call.
+        /// \return Pointer to the report, or `nullptr` before the first shutdown.
+        const ShutdownReport* shutdown_report() const override {
+            return m_has_shutdown_report ? &m_shutdown_report : nullptr;
+        }
+
+        /// \brief Returns the number of component shutdowns still running on helper threads.
+        ///
+        /// Nonzero after a bounded `shutdown()` in which a component overran its deadline.
+        std::size_t running_shutdown_tasks() const override {
+            return m_running_shutdown_tasks->load(std::memory_order_acquire);
+        }
+
         /// \brief Shuts down all components with "soft shutdown" support.
         ///
         /// Calls `shutdown(signal)` on components implementing the `IShutdownable` interface
         /// in reverse registration order. Components must not modify this manager during shutdown.
         /// If any component throws an exception during shutdown, the error is logged and
         /// stored, and the shutdown process continues for the remaining components.
-        /// At the end, a summary of all errors is logged, and a `std::runtime_error` is thrown
-        /// if any errors occurred.
+        /// At the end, a summary of all errors is logged.
         ///
         /// This mechanism ensures that a failure in one component does not prevent others
-        /// from shutting down gracefully.
+        /// from shutting down gracefully. Deferred components whose `initialize()` ran but
+        /// that never reported ready are shut down first, and queued deferred changes are
+        /// dropped. With a bounded `ShutdownPolicy`, components also
+        /// get deadlines and may shut down in parallel; see `set_shutdown_policy()`.
+        /// Timings are available from `shutdown_report()` afterwards.
         ///
         /// \param signal The signal to pass to the shutdown method.
-        /// \throws std::runtime_error If one or more components fail during shutdown.
-        void shutdown(int signal) {
+        void shutdown(int signal) override {
 #           if CONSOLIX_USE_LOGIT == 1
             LOGIT_PRINT_INFO("Starting shutdown with signal: ", signal);
 #           endif
+            ServiceLocator::Scope scope(*m_locator);
+            shutdown_deferred(signal);
+            const auto started = std::chrono::steady_clock::now();
+            m_shutdown_report = ShutdownReport();
+            m_shutdown_report.components.resize(m_components.size());
+            for (std::size_t index = 0; index < m_components.size(); ++index) {
+                ComponentShutdownTiming& timing = m_shutdown_report.components[index];
+                timing.index = index;
+                if (m_components[index].component) {
+                    timing.name = typeid(*m_components[index].component).name();
+                }
+            }
+
+            if (m_shutdown_policy.uses_threads()) {
+                shutdown_bounded(signal, started);
+            } else {
+                shutdown_sequential(signal);
+            }
+            m_shutdown_report.total = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - started);
+            m_has_shutdown_report = true;
+
             std::vector<std::string> errors; // Собираем ошибки
-            for (size_t remaining = m_components.size(); remaining > 0; --remaining) {
-                const size_t index = remaining - 1;
-                const auto& component = m_components[index];
-                try {
-                    if (auto shutdownable = std::dynamic_pointer_cast<IShutdownable>(component)) {
-                        shutdownable->shutdown(signal);
-                    }
-                } catch (const std::exception& e) {
-#                   if CONSOLIX_USE_LOGIT == 1
-                    LOGIT_PRINT_FATAL("Component [", index, "] shutdown error: ", e.what());
-#                   endif
-                    errors.push_back("Component [" + std::to_string(index) + "] error: " + e.what());
-                } catch (...) {
-#                   if CONSOLIX_USE_LOGIT == 1
-                    LOGIT_PRINT_FATAL("Component [", index, "] shutdown error: Unknown error");
-#                   endif
-                    errors.push_back("Component [" + std::to_string(index) + "] error: Unknown error");
+            for (const auto& timing : m_shutdown_report.components) {
+                if (timing.failed) {
+                    errors.push_back("Component [" + std::to_string(timing.index) + "] error: " + timing.error);
                 }
             }
 
@@ -154,8 +473,831 @@ namespace consolix {
         }
 
     private:
-        /// \brief List of managed application components.
-        std::vector<std::shared_ptr<IAppComponent>> m_components;
+        /// \brief Initialization state of a component during a parallel pass.
+        enum class InitState {
+            Ready,      ///< Initialized before or during this pass.
+            Waiting,    ///< Pending and not visited yet in this pass.
+            NotReady    ///< Visited in this pass but still not initialized.
+        };
+
+        /// \brief Runs one parallel initialization pass over the pending components.
+        bool initialize_parallel() {
+            std::vector<InitState> states(m_components.size(), InitState::Ready);
+            for (std::size_t index : m_pending) {
+                states[index] = InitState::Waiting;
+            }
+
+            try {
+                std::vector<std::size_t> segment;
+                for (std::size_t index : m_pending) {
+                    if (m_components[index].dependencies) {
+                        segment.push_back(index);
+                        continue;
+                    }
+                    initialize_segment(segment, states);
+                    segment.clear();
+                    initialize_one(index, states);
+                }
+                initialize_segment(segment, states);
+            } catch (const std::exception& e) {
+                prune_pending(states);
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_PRINT_FATAL("Initialization error: ", e.what());
+#               endif
+                throw;
+            } catch (...) {
+                prune_pending(states);
+                throw;
+            }
+
+            prune_pending(states);
+            return m_pending.empty();
+        }
+
+        /// \brief Initializes a run of declared components in dependency waves.
+        void initialize_segment(const std::vector<std::size_t>& segment, std::vector<InitState>& states) {
+            if (segment.empty()) {
+                return;
+            }
+
+            std::vector<std::vector<std::size_t>> dependencies;
+            dependencies.reserve(segment.size());
+            for (std::size_t index : segment) {
+                dependencies.push_back(dependency_indices(index));
+            }
+
+            std::vector<std::size_t> remaining(segment.size());
+            for (std::size_t i = 0; i < remaining.size(); ++i) {
+                remaining[i] = i;
+            }
+
+            while (!remaining.empty()) {
+                std::vector<std::size_t> wave;
+                std::vector<std::size_t> blocked;
+                for (std::size_t position : remaining) {
+                    bool ready = true;
+                    bool waiting = false;
+                    for (std::size_t dependency : dependencies[position]) {
+                        if (states[dependency] == InitState::Ready) continue;
+                        ready = false;
+                        if (states[dependency] == InitState::Waiting &&
+                            std::find(segment.begin(), segment.end(), dependency) != segment.end()) {
+                            waiting = true;
+                        }
+                    }
+                    if (ready) {
+                        wave.push_back(segment[position]);
+                    } else if (waiting) {
+                        blocked.push_back(position);
+                    } else {
+                        // Depends on a component that is not ready or runs after a later barrier.
+                        states[segment[position]] = InitState::NotReady;
+                    }
+                }
+
+                if (wave.empty()) {
+                    if (!blocked.empty()) {
+                        throw std::logic_error("Component initialization dependency cycle detected");
+                    }
+                    break;
+                }
+
+                ServiceLocator* locator = m_locator;
+                worker_pool().run(wave.size(), [this, &wave, &states, locator](std::size_t i) {
+                    ServiceLocator::Scope scope(*locator);
+                    initialize_one(wave[i], states);
+                });
+                remaining.swap(blocked);
+            }
+        }
+
+        /// \brief Initializes one component and records whether it became ready.
+        void initialize_one(std::size_t index, std::vector<InitState>& states) {
+            IAppComponent* component = m_components[index].component;
+            states[index] = InitState::NotReady;
+            if (!component->is_initialized()) {
+                initialize_component(index);
+            }
+            if (component->is_initialized()) {
+                states[index] = InitState::Ready;
+            }
+        }
+
+        /// \brief Resolves declared dependencies of a component into component indices.
+        std::vector<std::size_t> dependency_indices(std::size_t index) const {
+            std::vector<std::size_t> result;
+            const IInitDependencies* declared = m_components[index].dependencies;
+            if (!declared) {
+                return result;
+            }
+
+            const std::vector<std::type_index> components = declared->component_dependencies();
+            const std::vector<std::type_index> services = declared->required_services();
+            for (std::size_t other = 0; other < m_components.size(); ++other) {
+                if (other == index) continue;
+                const IAppComponent& component = *m_components[other].component;
+                if (std::find(components.begin(), components.end(), std::type_index(typeid(component))) != components.end()) {
+                    result.push_back(other);
+                    continue;
+                }
+                if (services.empty()) continue;
+                const IInitDependencies* provider = m_components[other].dependencies;
+                if (!provider) continue;
+                for (const auto& provided : provider->provided_services()) {
+                    if (std::find(services.begin(), services.end(), provided) != services.end()) {
+                        result.push_back(other);
+                        break;
+                    }
+                }
+            }
+            return result;
+        }
+
+        /// \brief Removes components that became ready from the pending list.
+        void prune_pending(const std::vector<InitState>& states) {
+            m_pending.erase(
+                std::remove_if(m_pending.begin(), m_pending.end(), [&states](std::size_t index) {
+                    return states[index] == InitState::Ready;
+                }),
+                m_pending.end());
+        }
+
+        /// \brief Per-component schedule and its progress.
+        struct ScheduleState {
+            ComponentSchedule                     schedule;
+            std::chrono::steady_clock::time_point next_due{};     ///< Next due time of a period schedule.
+            std::uint64_t                         passes{0};      ///< Passes seen by an iteration schedule.
+            LoopWakeService::Generation           wake_generation{0}; ///< Wake generation of the last run.
+            bool                                  primed{false};  ///< Whether an on-wake schedule ran its first pass.
+            bool                                  ran{false};     ///< Whether the component ran in the last pass.
+        };
+
+        /// \brief Optional interfaces a component implements.
+        enum Capability : std::uint32_t {
+            ShutdownCapability        = 1u << 0, ///< Implements `IShutdownable`.
+            WorkReportCapability      = 1u << 1, ///< Implements `IWorkReporter`.
+            InitDependencyCapability  = 1u << 2, ///< Implements `IInitDependencies`.
+            ParallelProcessCapability = 1u << 3, ///< Implements `IParallelProcess`.
+            SignalCapability          = 1u << 4  ///< Implements `ISignalSubscriber`.
+        };
+
+        /// \brief Component table row: the component and its resolved interfaces.
+        struct ComponentEntry {
+            std::shared_ptr<IAppComponent> owner;                 ///< Keeps the component alive.
+            IAppComponent*                 component{nullptr};
+            IShutdownable*                 shutdownable{nullptr};
+            IWorkReporter*                 reporter{nullptr};
+            IInitDependencies*             dependencies{nullptr};
+            ISignalSubscriber*             subscriber{nullptr};
+            std::uint32_t                  capabilities{0};       ///< Bitwise OR of `Capability` values.
+
+            /// \brief Resolves the optional interfaces once, when the component is added.
+            explicit ComponentEntry(std::shared_ptr<IAppComponent> ptr) :
+                    owner(std::move(ptr)),
+                    component(owner.get()),
+                    shutdownable(dynamic_cast<IShutdownable*>(component)),
+                    reporter(dynamic_cast<IWorkReporter*>(component)),
+                    dependencies(dynamic_cast<IInitDependencies*>(component)),
+                    subscriber(dynamic_cast<ISignalSubscriber*>(component)) {
+                if (shutdownable) capabilities |= ShutdownCapability;
+                if (reporter) capabilities |= WorkReportCapability;
+                if (dependencies) capabilities |= InitDependencyCapability;
+                if (dynamic_cast<IParallelProcess*>(component)) capabilities |= ParallelProcessCapability;
+                if (subscriber) capabilities |= SignalCapability;
+            }
+
+            /// \brief Checks a capability flag.
+            bool has(Capability capability) const {
+                return (capabilities & capability) != 0;
+            }
+        };
+
+        /// \brief Completion state shared with a shutdown helper thread.
+        struct ShutdownTask {
+            std::mutex                            mutex;
+            std::condition_variable               condition;
+            bool                                  done{false};
+            std::exception_ptr                    error;
+            std::chrono::steady_clock::time_point started{};
+            std::chrono::steady_clock::time_point finished{};
+        };
+
+        /// \brief Shuts components down one at a time on the calling thread.
+        void shutdown_sequential(int signal) {
+            for (size_t remaining = m_components.size(); remaining > 0; --remaining) {
+                const size_t index = remaining - 1;
+                IShutdownable* shutdownable = m_components[index].shutdownable;
+                if (!shutdownable) continue;
+                ComponentShutdownTiming& timing = m_shutdown_report.components[index];
+                const auto started = std::chrono::steady_clock::now();
+                try {
+                    shutdownable->shutdown(signal);
+                } catch (const std::exception& e) {
+                    record_shutdown_error(timing, e.what());
+                } catch (...) {
+                    record_shutdown_error(timing, "Unknown error");
+                }
+                timing.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - started);
+            }
+        }
+
+        /// \brief Shuts components down on helper threads, in dependency waves and under deadlines.
+        void shutdown_bounded(int signal, std::chrono::steady_clock::time_point started) {
+            typedef std::chrono::steady_clock::time_point TimePoint;
+            const TimePoint deadline = m_shutdown_policy.total_timeout() > std::chrono::milliseconds(0)
+                ? started + m_shutdown_policy.total_timeout()
+                : TimePoint::max();
+
+            std::vector<std::size_t> segment;
+            for (std::size_t remaining = m_components.size(); remaining > 0; --remaining) {
+                const std::size_t index = remaining - 1;
+                if (m_components[index].dependencies && m_shutdown_policy.threads() > 1) {
+                    segment.push_back(index);
+                    continue;
+                }
+                shutdown_segment(segment, signal, deadline);
+                segment.assign(1, index);
+                shutdown_segment(segment, signal, deadline);
+                segment.clear();
+            }
+            shutdown_segment(segment, signal, deadline);
+        }
+
+        /// \brief Shuts a run of components down in waves; a component waits for its dependents.
+        /// \param segment Component indices in reverse registration order.
+        void shutdown_segment(
+                const std::vector<std::size_t>& segment,
+                int signal,
+                std::chrono::steady_clock::time_point deadline) {
+            if (segment.empty()) {
+                return;
+            }
+
+            // blockers[i]: components of the segment that depend on segment[i].
+            std::vector<std::vector<std::size_t>> blockers(segment.size());
+            if (segment.size() > 1) {
+                for (std::size_t position = 0; position < segment.size(); ++position) {
+                    for (std::size_t dependency : dependency_indices(segment[position])) {
+                        auto it = std::find(segment.begin(), segment.end(), dependency);
+                        if (it != segment.end()) {
+                            blockers[static_cast<std::size_t>(it - segment.begin())].push_back(segment[position]);
+                        }
+                    }
+                }
+            }
+
+            std::vector<bool> finished(m_components.size(), false);
+            std::vector<std::size_t> remaining(segment.size());
+            for (std::size_t i = 0; i < remaining.size(); ++i) {
+                remaining[i] = i;
+            }
+
+            const std::size_t limit = std::max<std::size_t>(1, m_shutdown_policy.threads());
+            while (!remaining.empty()) {
+                std::vector<std::size_t> wave;
+                std::vector<std::size_t> blocked;
+                for (std::size_t position : remaining) {
+                    bool ready = true;
+                    for (std::size_t dependent : blockers[position]) {
+                        if (!finished[dependent]) {
+                            ready = false;
+                            break;
+                        }
+                    }
+                    if (ready && wave.size() < limit) {
+                        wave.push_back(segment[position]);
+                    } else {
+                        blocked.push_back(position);
+                    }
+                }
+                if (wave.empty()) {
+                    // Dependency cycle: fall back to reverse registration order.
+                    wave.push_back(segment[blocked.front()]);
+                    blocked.erase(blocked.begin());
+                }
+
+                run_shutdown_wave(wave, signal, deadline);
+                for (std::size_t index : wave) {
+                    finished[index] = true;
+                }
+                remaining.swap(blocked);
+            }
+        }
+
+        /// \brief Starts one helper thread per component of a wave and waits up to the deadlines.
+        void run_shutdown_wave(
+                const std::vector<std::size_t>& wave,
+                int signal,
+                std::chrono::steady_clock::time_point deadline) {
+            typedef std::chrono::steady_clock Clock;
+            std::vector<std::shared_ptr<ShutdownTask>> tasks(wave.size());
+            for (std::size_t i = 0; i < wave.size(); ++i) {
+                const ComponentEntry& entry = m_components[wave[i]];
+                if (!entry.shutdownable) continue;
+                ComponentShutdownTiming& timing = m_shutdown_report.components[wave[i]];
+                if (Clock::now() >= deadline) {
+                    timing.skipped = true;
+#                   if CONSOLIX_USE_LOGIT == 1
+                    LOGIT_PRINT_FATAL("Component [", wave[i], "] shutdown skipped: total deadline passed");
+#                   endif
+                    continue;
+                }
+                tasks[i] = start_shutdown_task(entry, signal);
+            }
+
+            for (std::size_t i = 0; i < wave.size(); ++i) {
+                if (!tasks[i]) continue;
+                ShutdownTask& task = *tasks[i];
+                ComponentShutdownTiming& timing = m_shutdown_report.components[wave[i]];
+                Clock::time_point task_deadline = deadline;
+                if (m_shutdown_policy.component_timeout() > std::chrono::milliseconds(0)) {
+                    task_deadline = std::min(task_deadline, task.started + m_shutdown_policy.component_timeout());
+                }
+
+                std::unique_lock<std::mutex> lock(task.mutex);
+                if (task_deadline == Clock::time_point::max()) {
+                    task.condition.wait(lock, [&task]() { return task.done; });
+                } else {
+                    task.condition.wait_until(lock, task_deadline, [&task]() { return task.done; });
+                }
+                if (!task.done) {
+                    timing.timed_out = true;
+                    timing.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                        Clock::now() - task.started);
+#                   if CONSOLIX_USE_LOGIT == 1
+                    LOGIT_PRINT_FATAL("Component [", wave[i], "] shutdown overran its deadline; continuing");
+#                   endif
+                    continue;
+                }
+                timing.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                    task.finished - task.started);
+                if (task.error) {
+                    try {
+                        std::rethrow_exception(task.error);
+                    } catch (const std::exception& e) {
+                        record_shutdown_error(timing, e.what());
+                    } catch (...) {
+                        record_shutdown_error(timing, "Unknown error");
+                    }
+                }
+            }
+        }
+
+        /// \brief Runs a component's shutdown on a detached thread that keeps the component alive.
+        ///
+        /// The thread uses the bound locator, which must outlive it; it is counted in
+        /// `running_shutdown_tasks()` until `shutdown()` returns from the component.
+        std::shared_ptr<ShutdownTask> start_shutdown_task(const ComponentEntry& entry, int signal) {
+            std::shared_ptr<ShutdownTask> task = std::make_shared<ShutdownTask>();
+            std::shared_ptr<IAppComponent> owner = entry.owner;
+            IShutdownable* shutdownable = entry.shutdownable;
+            ServiceLocator* locator = m_locator;
+            std::shared_ptr<std::atomic<std::size_t>> running = m_running_shutdown_tasks;
+            task->started = std::chrono::steady_clock::now();
+            running->fetch_add(1, std::memory_order_acq_rel);
+            auto body = [task, owner, shutdownable, locator, running, signal]() {
+                std::exception_ptr error;
+                try {
+                    ServiceLocator::Scope scope(*locator);
+                    shutdownable->shutdown(signal);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(task->mutex);
+                running->fetch_sub(1, std::memory_order_acq_rel);
+                task->error = error;
+                task->finished = std::chrono::steady_clock::now();
+                task->done = true;
+                task->condition.notify_all();
+            };
+            std::shared_ptr<ThreadPlacement> placement = locator->find_service<ThreadPlacement>();
+            try {
+                std::thread([placement, body]() {
+                    const PlacedThread placed = place_current_thread(placement, "cx-shutdown");
+                    body();
+                }).detach();
+            } catch (const std::system_error&) {
+                body(); // No thread available: shut down inline.
+            }
+            return task;
+        }
+
+        /// \brief Records and logs a component shutdown error.
+        static void record_shutdown_error(ComponentShutdownTiming& timing, const std::string& message) {
+#           if CONSOLIX_USE_LOGIT == 1
+            LOGIT_PRINT_FATAL("Component [", timing.index, "] shutdown error: ", message);
+#           endif
+            timing.failed = true;
+            timing.error = message;
+        }
+
+        /// \brief Captures the time and wake generation shared by one scheduled pass.
+        void begin_scheduled_pass() {
+            m_pass_time = std::chrono::steady_clock::now();
+            if (m_on_wake_count != 0) {
+                LoopWakeService* service = m_wake_service.get();
+                m_pass_wake_generation = service ? service->generation() : 0;
+            }
+        }
+
+        /// \brief Checks whether a component is due in the current pass and records the result.
+        bool is_due(std::size_t index) {
+            ScheduleState& state = m_schedules[index];
+            state.ran = advance_schedule(state);
+            return state.ran;
+        }
+
+        /// \brief Advances a component's schedule for the current pass.
+        /// \return `true` if the component is due.
+        bool advance_schedule(ScheduleState& state) const {
+            switch (state.schedule.mode()) {
+            case ComponentSchedule::Mode::EveryIteration:
+                return true;
+            case ComponentSchedule::Mode::Period:
+                if (m_pass_time < state.next_due) {
+                    return false;
+                }
+                state.next_due += state.schedule.period();
+                if (state.next_due <= m_pass_time) {
+                    state.next_due = m_pass_time + state.schedule.period();
+                }
+                return true;
+            case ComponentSchedule::Mode::Iterations:
+                return state.passes++ % state.schedule.iterations() == 0;
+            case ComponentSchedule::Mode::OnWake:
+                if (state.primed && state.wake_generation == m_pass_wake_generation) {
+                    return false;
+                }
+                state.primed = true;
+                state.wake_generation = m_pass_wake_generation;
+                return true;
+            }
+            return true;
+        }
+
+        /// \brief Runs one processing pass as a sequence of sequential and parallel stages.
+        void process_parallel() {
+            if (m_stages_dirty) {
+                build_process_stages();
+            }
+
+            ForkJoinPool& pool = worker_pool();
+            ServiceLocator* locator = m_locator;
+            for (const auto& stage : m_process_stages) {
+                m_due.clear();
+                for (std::size_t index = stage.first; index < stage.second; ++index) {
+                    if (m_scheduled_count == 0 || is_due(index)) {
+                        m_due.push_back(index);
+                    }
+                }
+                if (m_due.size() == 1) {
+                    process_component(m_due.front());
+                    continue;
+                }
+                pool.run(m_due.size(), [this, locator](std::size_t i) {
+                    ServiceLocator::Scope scope(*locator);
+                    process_component(m_due[i]);
+                });
+            }
+        }
+
+        /// \brief Groups consecutive `IParallelProcess` components into stages.
+        void build_process_stages() {
+            m_process_stages.clear();
+            std::size_t index = 0;
+            while (index < m_components.size()) {
+                std::size_t end = index + 1;
+                if (m_components[index].has(ParallelProcessCapability)) {
+                    while (end < m_components.size() &&
+                           m_components[end].has(ParallelProcessCapability)) {
+                        ++end;
+                    }
+                }
+                m_process_stages.push_back(std::make_pair(index, end));
+                index = end;
+            }
+            m_stages_dirty = false;
+        }
+
+        /// \brief Appends a component to the table, resolving its capabilities.
+        void append_component(std::shared_ptr<IAppComponent> component) {
+            append_component(ComponentEntry(std::move(component)));
+        }
+
+        /// \brief Appends an already resolved table row.
+        void append_component(ComponentEntry entry) {
+            if (entry.reporter) {
+                ++m_reporter_count;
+            }
+            if (entry.subscriber) {
+                ++m_subscriber_count;
+            }
+            m_components.push_back(std::move(entry));
+            m_schedules.push_back(ScheduleState());
+            m_stages_dirty = true;
+        }
+
+        /// \brief Queues a deferred add or remove.
+        void post_change(bool add, std::shared_ptr<IAppComponent> component) {
+            if (!component) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_staged->mutex);
+            m_staged->changes.push_back(std::make_pair(add, std::move(component)));
+            m_staged->pending.store(true, std::memory_order_release);
+        }
+
+        /// \brief Applies queued adds and removes at a pass boundary, on the loop thread.
+        void apply_deferred_changes() {
+            std::vector<std::pair<bool, std::shared_ptr<IAppComponent>>> changes;
+            {
+                std::lock_guard<std::mutex> lock(m_staged->mutex);
+                changes.swap(m_staged->changes);
+                m_staged->pending.store(false, std::memory_order_relaxed);
+            }
+
+            ServiceLocator::Scope scope(*m_locator);
+            for (auto& change : changes) {
+                if (change.first) {
+                    IncomingComponent incoming = {ComponentEntry(std::move(change.second)), false};
+                    m_incoming.push_back(std::move(incoming));
+                    continue;
+                }
+                auto incoming = std::find_if(
+                    m_incoming.begin(),
+                    m_incoming.end(),
+                    [&change](const IncomingComponent& item) {
+                        return item.entry.owner == change.second;
+                    });
+                if (incoming != m_incoming.end()) {
+                    if (incoming->started) {
+                        shutdown_incoming(incoming->entry, 0);
+                    }
+                    m_incoming.erase(incoming);
+                    continue;
+                }
+                remove_component(change.second);
+            }
+
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < m_incoming.size(); ++i) {
+                IncomingComponent& incoming = m_incoming[i];
+                IAppComponent* component = incoming.entry.component;
+                try {
+                    if (!component->is_initialized()) {
+                        incoming.started = true;
+                        component->initialize();
+                    }
+                    if (!component->is_initialized()) {
+                        m_incoming[kept++] = incoming;
+                        continue;
+                    }
+                    append_component(incoming.entry);
+                } catch (const std::exception& e) {
+#                   if CONSOLIX_USE_LOGIT == 1
+                    LOGIT_PRINT_ERROR("Deferred component initialization failed, component discarded: ", e.what());
+#                   else
+                    (void)e;
+#                   endif
+                    if (incoming.started) {
+                        shutdown_incoming(incoming.entry, 0);
+                    }
+                } catch (...) {
+#                   if CONSOLIX_USE_LOGIT == 1
+                    LOGIT_PRINT_ERROR("Deferred component initialization failed, component discarded: unknown error");
+#                   endif
+                    if (incoming.started) {
+                        shutdown_incoming(incoming.entry, 0);
+                    }
+                }
+            }
+            m_incoming.erase(m_incoming.begin() + static_cast<std::ptrdiff_t>(kept), m_incoming.end());
+        }
+
+        /// \brief Shuts down a deferred component that left before reporting ready.
+        void shutdown_incoming(const ComponentEntry& entry, int signal) {
+            if (!entry.shutdownable) {
+                return;
+            }
+            try {
+                entry.shutdownable->shutdown(signal);
+            } catch (const std::exception& e) {
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_PRINT_ERROR("Deferred component shutdown error: ", e.what());
+#               else
+                (void)e;
+#               endif
+            } catch (...) {
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_PRINT_ERROR("Deferred component shutdown error: Unknown error");
+#               endif
+            }
+        }
+
+        /// \brief Drops queued deferred changes and shuts down components still initializing.
+        ///
+        /// Queued additions never ran `initialize()`, so they are only dropped. Queued
+        /// removals need no work: their components are shut down here or by `shutdown()`.
+        void shutdown_deferred(int signal) {
+            {
+                std::lock_guard<std::mutex> lock(m_staged->mutex);
+                m_staged->changes.clear();
+                m_staged->pending.store(false, std::memory_order_relaxed);
+            }
+            for (std::size_t remaining = m_incoming.size(); remaining > 0; --remaining) {
+                const IncomingComponent& incoming = m_incoming[remaining - 1];
+                if (incoming.started) {
+                    shutdown_incoming(incoming.entry, signal);
+                }
+            }
+            m_incoming.clear();
+        }
+
+        /// \brief Shuts down a component and drops it from the table.
+        void remove_component(const std::shared_ptr<IAppComponent>& component) {
+            std::size_t index = 0;
+            while (index < m_components.size() && m_components[index].owner != component) {
+                ++index;
+            }
+            if (index == m_components.size()) {
+                return;
+            }
+
+            ComponentEntry& entry = m_components[index];
+            if (entry.shutdownable) {
+                try {
+                    entry.shutdownable->shutdown(0);
+                } catch (const std::exception& e) {
+#                   if CONSOLIX_USE_LOGIT == 1
+                    LOGIT_PRINT_ERROR("Component [", index, "] shutdown error during removal: ", e.what());
+#                   else
+                    (void)e;
+#                   endif
+                } catch (...) {
+#                   if CONSOLIX_USE_LOGIT == 1
+                    LOGIT_PRINT_ERROR("Component [", index, "] shutdown error during removal: Unknown error");
+#                   endif
+                }
+            }
+
+            if (entry.reporter) {
+                --m_reporter_count;
+            }
+            if (entry.subscriber) {
+                --m_subscriber_count;
+            }
+            const ComponentSchedule::Mode mode = m_schedules[index].schedule.mode();
+            if (mode != ComponentSchedule::Mode::EveryIteration) --m_scheduled_count;
+            if (mode == ComponentSchedule::Mode::OnWake) --m_on_wake_count;
+
+            m_components.erase(m_components.begin() + index);
+            m_schedules.erase(m_schedules.begin() + index);
+            m_pending.erase(std::remove(m_pending.begin(), m_pending.end(), index), m_pending.end());
+            for (auto& pending : m_pending) {
+                if (pending > index) --pending;
+            }
+#           if CONSOLIX_COMPONENT_STATS == 1
+            for (auto& shard : m_stats) {
+                if (index < shard.process.size()) {
+                    shard.process.erase(shard.process.begin() + index);
+                    shard.initialize.erase(shard.initialize.begin() + index);
+                }
+            }
+#           endif
+            m_stages_dirty = true;
+        }
+
+        /// \brief Calls `process()` on one component, timing it when statistics are enabled.
+        void process_component(std::size_t index) {
+#           if CONSOLIX_COMPONENT_STATS == 1
+            const auto started = std::chrono::steady_clock::now();
+            m_components[index].component->process();
+            stats_shard().process[index].record(elapsed_ns(started));
+#           else
+            m_components[index].component->process();
+#           endif
+        }
+
+        /// \brief Calls `initialize()` on one component, timing it when statistics are enabled.
+        void initialize_component(std::size_t index) {
+#           if CONSOLIX_COMPONENT_STATS == 1
+            const auto started = std::chrono::steady_clock::now();
+            m_components[index].component->initialize();
+            stats_shard().initialize[index].record(elapsed_ns(started));
+#           else
+            m_components[index].component->initialize();
+#           endif
+        }
+
+        /// \brief Sizes the per-thread statistics before components run.
+        void prepare_stats() {
+#           if CONSOLIX_COMPONENT_STATS == 1
+            const std::size_t threads = std::max(m_initialization_threads, m_processing_threads);
+            const std::size_t shards = threads > 1 ? threads : 1;
+            if (m_stats.size() == shards && m_stats.front().process.size() == m_components.size()) {
+                return;
+            }
+            m_stats.resize(shards);
+            for (auto& shard : m_stats) {
+                shard.process.resize(m_components.size());
+                shard.initialize.resize(m_components.size());
+            }
+#           endif
+        }
+
+#       if CONSOLIX_COMPONENT_STATS == 1
+        /// \brief Histograms written by one thread.
+        struct StatsShard {
+            std::vector<LatencyHistogram> process;    ///< One per component.
+            std::vector<LatencyHistogram> initialize; ///< One per component.
+        };
+
+        /// \brief Returns the shard of the calling thread: the caller uses 0, pool workers their slot.
+        StatsShard& stats_shard() {
+            const std::size_t slot = m_pool ? m_pool->current_worker_slot() : 0;
+            return m_stats[slot < m_stats.size() ? slot : 0];
+        }
+
+        static std::uint64_t elapsed_ns(std::chrono::steady_clock::time_point started) {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - started).count());
+        }
+#       endif
+
+        /// \brief Returns the persistent pool sized for the configured thread counts.
+        ForkJoinPool& worker_pool() {
+            const std::size_t threads = std::max(m_initialization_threads, m_processing_threads);
+            const std::size_t workers = threads > 1 ? threads - 1 : 0;
+            if (!m_pool || m_pool->worker_count() != workers) {
+                m_pool.reset(new ForkJoinPool(workers, m_locator->find_service<ThreadPlacement>()));
+            }
+            return *m_pool;
+        }
+
+        /// \brief Component table in registration order.
+        std::vector<ComponentEntry> m_components;
+        /// \brief Number of components implementing `IWorkReporter`.
+        std::size_t m_reporter_count{0};
+        /// \brief Number of components implementing `ISignalSubscriber`.
+        std::size_t m_subscriber_count{0};
+        /// \brief Indices of components that have not reported ready yet.
+        std::vector<std::size_t> m_pending;
+        /// \brief Locator made current during initialization and shutdown.
+        ServiceLocator* m_locator;
+        /// \brief Wake service used by on-wake schedules.
+        ServiceRef<LoopWakeService> m_wake_service;
+        /// \brief Threads used for initialization; values above one enable parallel mode.
+        std::size_t m_initialization_threads{0};
+        /// \brief Threads used for processing; values above one enable parallel stages.
+        std::size_t m_processing_threads{0};
+        /// \brief Processing stages as `[first, last)` component index ranges.
+        std::vector<std::pair<std::size_t, std::size_t>> m_process_stages;
+        /// \brief Whether the component table changed since the stages were built.
+        bool m_stages_dirty{true};
+        /// \brief Worker pool created on first parallel use.
+        std::unique_ptr<ForkJoinPool> m_pool;
+        /// \brief Components of the current parallel stage that are due.
+        std::vector<std::size_t> m_due;
+        /// \brief Number of components with a non-default schedule.
+        std::size_t m_scheduled_count{0};
+        /// \brief Number of components that run only on wake requests.
+        std::size_t m_on_wake_count{0};
+        /// \brief Schedules, one per component; kept apart from the component table,
+        /// which `process()` walks on every pass.
+        std::vector<ScheduleState> m_schedules;
+        /// \brief Deadlines and parallelism applied by `shutdown()`.
+        ShutdownPolicy m_shutdown_policy;
+        /// \brief Timings of the last `shutdown()` call.
+        ShutdownReport m_shutdown_report;
+        /// \brief Shutdown helper threads still running; shared with the threads, which may outlive the manager.
+        std::shared_ptr<std::atomic<std::size_t>> m_running_shutdown_tasks{
+            std::make_shared<std::atomic<std::size_t>>(0)};
+        /// \brief Deferred adds and removes posted from other threads.
+        struct StagedChanges {
+            std::mutex        mutex;
+            std::vector<std::pair<bool, std::shared_ptr<IAppComponent>>> changes; ///< `true` adds, `false` removes.
+            std::atomic<bool> pending{false}; ///< Set while `changes` is not empty.
+        };
+        /// \brief Queue shared with posting threads; heap-allocated to keep the manager movable.
+        std::unique_ptr<StagedChanges> m_staged{new StagedChanges()};
+        /// \brief Deferred component waiting to report ready.
+        struct IncomingComponent {
+            ComponentEntry entry;   ///< Resolved when queued, so shutdown needs no extra cast.
+            bool           started; ///< Whether `initialize()` has run.
+        };
+        /// \brief Deferred components waiting to report ready; touched by the loop thread only.
+        std::vector<IncomingComponent> m_incoming;
+        /// \brief Whether `m_shutdown_report` holds a finished shutdown.
+        bool m_has_shutdown_report{false};
+#       if CONSOLIX_COMPONENT_STATS == 1
+        /// \brief Timing histograms, one shard per thread that runs components.
+        std::vector<StatsShard> m_stats;
+#       endif
+        /// \brief Time captured at the start of the current scheduled pass.
+        std::chrono::steady_clock::time_point m_pass_time{};
+        /// \brief Wake generation captured at the start of the current scheduled pass.
+        LoopWakeService::Generation m_pass_wake_generation{0};
     }; // AppComponentManager
 
 }; // namespace consolix
@@ -0,0 +1,95 @@
+#pragma once
+#ifndef _CONSOLIX_COMPONENT_SCHEDULE_HPP_INCLUDED
+#define _CONSOLIX_COMPONENT_SCHEDULE_HPP_INCLUDED
+
+/// \file ComponentSchedule.hpp
+/// \brief Describes how often a managed component's `process()` runs.
+/// \ingroup Core
+
+#include <chrono>
+#include <cstdint>
+
+namespace consolix {
+
+    /// \class ComponentSchedule
+    /// \brief Cadence of a component inside `AppComponentManager::process()`.
+    ///
+    /// - `every_iteration()`: the default; runs on every pass.
+    /// - `every(period)`: runs when the period has elapsed since the previous due time.
+    ///   A component that falls more than one period behind is rescheduled from now
+    ///   instead of running a burst of catch-up passes.
+    /// - `every_n_iterations(n)`: runs on the first pass and then on every `n`-th pass.
+    /// - `on_wake()`: runs on the first pass, so it sees state from before any wake,
+    ///   and then only on passes after `LoopWakeService` was woken. Without a
+    ///   registered `LoopWakeService` it runs on the first pass only.
+    class ComponentSchedule {
+    public:
+        /// \brief Scheduling mode.
+        enum class Mode {
+            EveryIteration, ///< Runs on every pass.
+            Period,         ///< Runs once per time period.
+            Iterations,     ///< Runs once per N passes.
+            OnWake          ///< Runs after loop wake requests.
+        };
+
+        /// \brief Creates the default every-pass schedule.
+        ComponentSchedule() = default;
+
+        /// \brief Runs the component on every pass.
+        static ComponentSchedule every_iteration() {
+            return ComponentSchedule();
+        }
+
+        /// \brief Runs the component once per `period`.
+        /// \param period Time between runs; non-positive values mean every pass.
+        static ComponentSchedule every(std::chrono::milliseconds period) {
+            ComponentSchedule schedule;
+            if (period > std::chrono::milliseconds(0)) {
+                schedule.m_mode = Mode::Period;
+                schedule.m_period = period;
+            }
+            return schedule;
+        }
+
+        /// \brief Runs the component once per `iterations` passes.
+        /// \param iterations Pass count between runs; `0` and `1` mean every pass.
+        static ComponentSchedule every_n_iterations(std::uint64_t iterations) {
+            ComponentSchedule schedule;
+            if (iterations > 1) {
+                schedule.m_mode = Mode::Iterations;
+                schedule.m_iterations = iterations;
+            }
+            return schedule;
+        }
+
+        /// \brief Runs the component on the first pass and then after `LoopWakeService` wake requests.
+        static ComponentSchedule on_wake() {
+            ComponentSchedule schedule;
+            schedule.m_mode = Mode::OnWake;
+            return schedule;
+        }
+
+        /// \brief Returns the scheduling mode.
+        Mode mode() const {
+            return m_mode;
+        }
+
+        /// \brief Returns the period of a `Mode::Period` schedule.
+        std::chrono::milliseconds period() const {
+            return m_period;
+        }
+
+        /// \brief Returns the pass count of a `Mode::Iterations` schedule.
+        std::uint64_t iterations() const {
+            return m_iterations;
+        }
+
+    private:
+        Mode                      m_mode{Mode::EveryIteration};
+        std::chrono::milliseconds m_period{0};
+        std::uint64_t             m_iterations{1};
+    }; // ComponentSchedule
+
+} // namespace consolix
+
+#endif // _CONSOLIX_COMPONENT_SCHEDULE_HPP_INCLUDED
@@ -0,0 +1,177 @@
+#pragma once
+#ifndef _CONSOLIX_COMPONENT_STATS_HPP_INCLUDED
+#define _CONSOLIX_COMPONENT_STATS_HPP_INCLUDED
+
+/// \file ComponentStats.hpp
+/// \brief Log-linear latency histograms and per-component timing statistics.
+/// \ingroup Core
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace consolix {
+
+    /// \class LatencyHistogram
+    /// \brief Fixed-size log-linear histogram of durations in nanoseconds.
+    ///
+    /// Values below 8 ns get one bucket each; every power of two above that is split
+    /// into 8 linear sub-buckets, so a bucket is at most 12.5% wide relative to its
+    /// lower bound. Values above about 18 minutes land in the last bucket. Recording
+    /// is a few integer operations and never allocates.
+    ///
+    /// A histogram is not thread-safe. Keep one per writer thread and `merge()` them
+    /// for reporting.
+    class LatencyHistogram {
+    public:
+        /// \brief Number of linear sub-buckets per power of two, as a bit count.
+        static constexpr unsigned sub_bucket_bits = 3;
+        /// \brief Number of linear sub-buckets per power of two.
+        static constexpr std::size_t sub_bucket_count = std::size_t(1) << sub_bucket_bits;
+        /// \brief Highest tracked power of two.
+        static constexpr unsigned max_exponent = 40;
+        /// \brief Total number of buckets.
+        static constexpr std::size_t bucket_count = (max_exponent - sub_bucket_bits + 2) * sub_bucket_count;
+
+        /// \brief Records one duration.
+        /// \param nanoseconds Duration to record.
+        void record(std::uint64_t nanoseconds) {
+            ++m_buckets[bucket_index(nanoseconds)];
+            ++m_count;
+            m_sum += nanoseconds;
+            m_min = std::min(m_min, nanoseconds);
+            m_max = std::max(m_max, nanoseconds);
+        }
+
+        /// \brief Adds the samples of another histogram.
+        void merge(const LatencyHistogram& other) {
+            for (std::size_t i = 0; i < bucket_count; ++i) {
+                m_buckets[i] += other.m_buckets[i];
+            }
+            m_count += other.m_count;
+            m_sum += other.m_sum;
+            m_min = std::min(m_min, other.m_min);
+            m_max = std::max(m_max, other.m_max);
+        }
+
+        /// \brief Removes all samples.
+        void reset() {
+            *this = LatencyHistogram();
+        }
+
+        /// \brief Returns the number of recorded samples.
+        std::uint64_t count() const {
+            return m_count;
+        }
+
+        /// \brief Returns the sum of recorded durations in nanoseconds.
+        std::uint64_t sum() const {
+            return m_sum;
+        }
+
+        /// \brief Returns the smallest recorded duration, or `0` when empty.
+        std::uint64_t min() const {
+            return m_count ? m_min : 0;
+        }
+
+        /// \brief Returns the largest recorded duration.
+        std::uint64_t max() const {
+            return m_max;
+        }
+
+        /// \brief Returns the mean duration, or `0` when empty.
+        std::uint64_t mean() const {
+            return m_count ? m_sum / m_count : 0;
+        }
+
+        /// \brief Returns an upper estimate of a quantile.
+        /// \param quantile Value in `[0, 1]`, for example `0.99`.
+        /// \return Upper bound of the bucket holding the quantile, clamped to `max()`.
+        std::uint64_t percentile(double quantile) const {
+            if (m_count == 0) {
+                return 0;
+            }
+            quantile = std::min(1.0, std::max(0.0, quantile));
+            std::uint64_t rank = static_cast<std::uint64_t>(quantile * static_cast<double>(m_count) + 0.5);
+            rank = std::max<std::uint64_t>(1, std::min(rank, m_count));
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < bucket_count; ++i) {
+                seen += m_buckets[i];
+                if (seen >= rank) {
+                    return std::min(bucket_upper_bound(i), m_max);
+                }
+            }
+            return m_max;
+        }
+
+        /// \brief Returns the samples in one bucket.
+        std::uint64_t bucket(std::size_t index) const {
+            return m_buckets[index];
+        }
+
+        /// \brief Returns the bucket that a duration falls into.
+        static std::size_t bucket_index(std::uint64_t nanoseconds) {
+            if (nanoseconds < sub_bucket_count) {
+                return static_cast<std::size_t>(nanoseconds);
+            }
+            const unsigned exponent = highest_bit(nanoseconds);
+            if (exponent > max_exponent) {
+                return bucket_count - 1;
+            }
+            const unsigned shift = exponent - sub_bucket_bits;
+            return (shift + 1) * sub_bucket_count +
+                   static_cast<std::size_t>((nanoseconds >> shift) & (sub_bucket_count - 1));
+        }
+
+        /// \brief Returns the smallest duration that falls into a bucket.
+        static std::uint64_t bucket_lower_bound(std::size_t index) {
+            if (index < sub_bucket_count) {
+                return index;
+            }
+            const unsigned shift = static_cast<unsigned>(index / sub_bucket_count - 1);
+            return static_cast<std::uint64_t>(sub_bucket_count + index % sub_bucket_count) << shift;
+        }
+
+        /// \brief Returns the largest duration that falls into a bucket.
+        static std::uint64_t bucket_upper_bound(std::size_t index) {
+            if (index + 1 >= bucket_count) {
+                return std::numeric_limits<std::uint64_t>::max();
+            }
+            return bucket_lower_bound(index + 1) - 1;
+        }
+
+    private:
+        std::array<std::uint64_t, bucket_count> m_buckets{};
+        std::uint64_t m_count{0};
+        std::uint64_t m_sum{0};
+        std::uint64_t m_min{std::numeric_limits<std::uint64_t>::max()};
+        std::uint64_t m_max{0};
+
+        static unsigned highest_bit(std::uint64_t value) {
+#           if defined(__GNUC__) || defined(__clang__)
+            return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#           else
+            unsigned bit = 0;
+            while (value >>= 1) {
+                ++bit;
+            }
+            return bit;
+#           endif
+        }
+    }; // LatencyHistogram
+
+    /// \struct ComponentStats
+    /// \brief Timing statistics of one managed component.
+    struct ComponentStats {
+        std::size_t      index{0};   ///< Registration index of the component.
+        std::string      name;       ///< Implementation-defined type name.
+        LatencyHistogram process;    ///< Durations of `process()` calls.
+        LatencyHistogram initialize; ///< Durations of `initialize()` calls.
+    };
+
+} // namespace consolix
+
+#endif // _CONSOLIX_COMPONENT_STATS_HPP_INCLUDED
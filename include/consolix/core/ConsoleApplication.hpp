@@ -136,9 +136,7 @@ namespace consolix {
 
         void initialize_or_exit() {
             try {
-                while (!m_runner.is_stop_requested() && !m_manager.initialize()) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                }
+                m_runner.initialize_components();
                 exit_if_stopping();
             } catch (const std::exception& e) {
                 exit_after_fatal_exception(e);
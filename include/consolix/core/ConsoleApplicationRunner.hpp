@@ -8,11 +8,15 @@
 
 #include "platform_includes.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <csignal>
+#include <cstdint>
+#include <cstring>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -20,6 +24,7 @@
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #if CONSOLIX_USE_LOGIT == 1
 #include <logit.hpp>
@@ -27,8 +32,18 @@
 
 #include "ServiceLocator.hpp"
 #include "AppComponentManager.hpp"
+#include "StaticComponentManager.hpp"
+#include "PreciseSleep.hpp"
 #include "LoopWakeService.hpp"
+#include "ComponentStats.hpp"
+#include "IdlePolicy.hpp"
+#include "ShutdownPolicy.hpp"
 #include "PosixSignalWakeService.hpp"
+#include "Reactor.hpp"
+#include "SignalFdService.hpp"
+#include "TimerService.hpp"
+#include "RealtimePolicy.hpp"
+#include "ThreadPlacement.hpp"
 
 #if !defined(_WIN32) && !defined(_WIN64)
 #include <signal.h>
@@ -36,6 +51,15 @@
 
 namespace consolix {
 
+    /// \struct BusyPollReport
+    /// \brief Loop timing of a busy-poll run (see `ConsoleApplicationRunner::enable_busy_poll()`).
+    struct BusyPollReport {
+        int              cpu{-1};       ///< Requested core, or `-1` when no pinning was requested.
+        bool             pinned{false}; ///< Whether the loop thread was pinned to `cpu`.
+        std::uint64_t    iterations{0}; ///< Passes run.
+        LatencyHistogram gaps;          ///< Time between the starts of consecutive passes.
+    };
+
     /// \class ConsoleApplicationRunner
     /// \brief Component runner that performs the Consolix lifecycle and returns an exit code.
     ///
@@ -43,17 +67,70 @@ namespace consolix {
     /// shuts them down, clears shared services, shuts down LogIt when enabled, and returns
     /// the resolved exit code. It never calls `std::exit`.
     ///
+    /// The runner works on the `ServiceLocator` bound to its manager: the locator is
+    /// current on the runner thread for the whole run, owns the loop wake service, and
+    /// is the only locator cleared during cleanup. Runners over managers with separate
+    /// locators can therefore run side by side on different threads.
+    ///
+    /// When the manager reports a future `next_deadline()` (for example, when every
+    /// component runs on a period schedule), the runner waits on `LoopWakeService`
+    /// until that deadline, a wake request, or `CONSOLIX_SCHEDULE_MAX_WAIT_MS`.
+    ///
+    /// With an `IdlePolicy` set and a manager whose components implement `IWorkReporter`,
+    /// passes that report no work make the runner spin, then yield, then park on
+    /// `LoopWakeService` for growing intervals until work or a wake request arrives.
+    ///
+    /// With `enable_reactor()` (Linux only) the runner blocks in an epoll `Reactor`
+    /// between passes instead. A pass then runs only after a registered descriptor or
+    /// timer fires, a wake request or signal arrives, or the manager's next deadline
+    /// passes, so an idle application uses no CPU. `enable_signalfd()` additionally reads
+    /// signals from a `SignalFdService` in the reactor: termination signals stop the
+    /// runner and the rest reach `ISignalSubscriber` components, with no watcher thread.
+    ///
+    /// With `enable_busy_poll()` the runner never sleeps: passes run back to back on
+    /// a loop thread optionally pinned to one core, with CPU `pause` hints after passes
+    /// that report no work. The stop flag is a relaxed load per pass and signals are
+    /// synchronized only every few hundred passes. `busy_poll_report()` gives the
+    /// distribution of gaps between passes.
+    ///
+    /// With `set_realtime_policy()` the runner applies real-time scheduling, memory
+    /// locking and prefaulting on the loop thread right before components are
+    /// initialized, so their allocations land in locked, already-faulted memory.
+    /// Settings the process may not apply are skipped; `realtime_report()` tells which
+    /// took effect.
+    ///
+    /// With `set_thread_placement()` the runner registers `CpuTopology` and a
+    /// `ThreadPlacement` in its locator, so the threads Consolix creates for the run
+    /// are named and pinned away from the loop thread's core. When the policy has an
+    /// anchor, the loop thread is pinned to it once components are initialized;
+    /// threads created during initialization keep the unpinned affinity.
+    ///
+    /// The runner also provides a `TimerService`: it advances the wheel before each
+    /// pass of the main loop, so timer callbacks run on the loop thread, and never
+    /// waits past the next timer expiry.
+    ///
+    /// After shutdown the runner copies the manager's `ShutdownReport`, logs the
+    /// per-component timings when LogIt is enabled, and returns
+    /// `CONSOLIX_SHUTDOWN_TIMEOUT_EXIT_CODE` instead of `0` if a component overran
+    /// its shutdown deadline.
+    ///
+    /// Once components are initialized, the runner freezes its locator so service
+    /// lookups from `process()` use the lock-free snapshot path.
+    ///
     /// On Windows, Ctrl+C/Ctrl+Break only request a cooperative stop. Close, logoff,
     /// and shutdown console events request stop and wait briefly for this runner to
     /// complete cleanup on the runner thread.
     ///
-    /// A runner instance is single-use. Create a new `AppComponentManager` and
+    /// The runner drives any `IComponentManager`: the dynamic `AppComponentManager` or
+    /// a compile-time `StaticComponentManager`.
+    ///
+    /// A runner instance is single-use. Create a new component manager and
     /// `ConsoleApplicationRunner` for a new application lifecycle.
     class ConsoleApplicationRunner {
     public:
         /// \brief Constructs a runner over an existing component manager.
         /// \param manager The component manager to drive.
-        explicit ConsoleApplicationRunner(AppComponentManager& manager) :
+        explicit ConsoleApplicationRunner(IComponentManager& manager) :
             m_manager(manager) {
         }
 
@@ -78,16 +155,22 @@ namespace consolix {
             }
 
             m_shutdown_complete.store(false);
+            ServiceLocator::Scope locator_scope(m_manager.service_locator());
             ActiveRunnerGuard active_runner_guard(*this);
             setup_loop_wake_service();
-            setup_signal_handlers();
+            setup_signal_handlers(!active_runner_guard.has_previous());
 
             int exit_code = 0;
             try {
+                setup_thread_placement();
+                setup_timer_service();
+                setup_reactor();
+                setup_realtime();
                 initialize_components();
-                while (!stop_requested()) {
-                    m_manager.process();
-                    iteration_action();
+                pin_loop_thread();
+                m_manager.service_locator().freeze();
+                if (!run_busy_poll_loop(iteration_action) && !run_reactor_loop(iteration_action)) {
+                    run_polling_loop(iteration_action);
                 }
                 exit_code = requested_exit_code();
             } catch (const std::exception& e) {
@@ -97,11 +180,195 @@ namespace consolix {
             }
 
             exit_code = cleanup(exit_code);
+            stop_signal_fd();
             mark_shutdown_complete();
             m_running.store(false);
             return exit_code;
         }
 
+        /// \brief Initializes components, waiting for readiness notifications between passes.
+        ///
+        /// The manager only re-polls components that are still pending. Between passes the
+        /// runner waits on `LoopWakeService`, so a component (or the thread it waits on) can
+        /// call `consolix::wake_loop()` when it becomes ready and the next pass starts at
+        /// once. Without a notification the next pass starts after `init_poll_interval()`.
+        /// \return `true` when all components are initialized, `false` if stop was requested first.
+        bool initialize_components() {
+            setup_loop_wake_service();
+            std::shared_ptr<LoopWakeService> service = loop_wake_service();
+            LoopWakeService::Generation observed_generation = service ? service->generation() : 0;
+            while (!stop_requested()) {
+                if (m_manager.initialize()) {
+                    return true;
+                }
+                if (wait_in_reactor(m_init_poll_interval)) {
+                    continue;
+                }
+                if (service) {
+                    service->wait_for_change(observed_generation, m_init_poll_interval);
+                } else {
+                    sleep_for_precise(m_init_poll_interval);
+                }
+            }
+            return false;
+        }
+
+        /// \brief Sets how the loop backs off while components report no work.
+        ///
+        /// Has no effect unless the manager reports work (see `IWorkReporter`).
+        /// \param policy Backoff budgets; `IdlePolicy::disabled()` keeps the loop hot.
+        void set_idle_policy(const IdlePolicy& policy) {
+            m_idle_policy = policy;
+        }
+
+        /// \brief Returns the configured idle policy.
+        const IdlePolicy& idle_policy() const {
+            return m_idle_policy;
+        }
+
+        /// \brief Makes the run busy-poll: passes run back to back and the loop never sleeps.
+        ///
+        /// Must be called before `run_for_exit_code()`. Takes precedence over reactor
+        /// mode and the idle policy. Wake requests still matter: they refresh the cached
+        /// timer deadline. Use on isolated cores; the loop thread keeps its core at 100%.
+        /// \param cpu Core to pin the loop thread to for the run; negative leaves the
+        /// affinity unchanged. The previous affinity is restored when the loop ends.
+        /// \param yield_every Yields the time slice after this many consecutive passes
+        /// without work (requires an `IWorkReporter` manager); `0` never yields.
+        void enable_busy_poll(int cpu = -1, std::uint32_t yield_every = 0) {
+            m_busy_poll_requested = true;
+            m_busy_poll_cpu = cpu;
+            m_busy_poll_yield_every = yield_every;
+        }
+
+        /// \brief Returns whether busy-poll mode was requested.
+        bool busy_poll_enabled() const {
+            return m_busy_poll_requested;
+        }
+
+        /// \brief Returns the busy-poll timing; safe to call while the run is active.
+        ///
+        /// During the run the report is refreshed every 65536 passes, and once more
+        /// when the loop ends.
+        BusyPollReport busy_poll_report() const {
+            std::lock_guard<std::mutex> lock(m_busy_poll_mutex);
+            return m_busy_poll_report;
+        }
+
+        /// \brief Sets the real-time settings applied before components are initialized.
+        ///
+        /// Must be called before `run_for_exit_code()`. The scheduling class is restored
+        /// when the run ends; process-wide settings stay in effect.
+        /// \param policy Requested settings; `RealtimePolicy::disabled()` skips the step.
+        void set_realtime_policy(const RealtimePolicy& policy) {
+            m_realtime_policy = policy;
+        }
+
+        /// \brief Returns the configured real-time policy.
+        const RealtimePolicy& realtime_policy() const {
+            return m_realtime_policy;
+        }
+
+        /// \brief Returns which real-time settings took effect; safe to call while the run is active.
+        RealtimeReport realtime_report() const {
+            std::lock_guard<std::mutex> lock(m_realtime_mutex);
+            return m_realtime_report;
+        }
+
+        /// \brief Sets where the threads Consolix creates are placed.
+        ///
+        /// Must be called before `run_for_exit_code()`. A negative anchor is replaced by
+        /// the busy-poll core. A `ThreadPlacement` already registered in the manager's
+        /// locator takes precedence over this policy.
+        /// \param policy Placement rules; `ThreadPlacementPolicy::disabled()` only names threads.
+        void set_thread_placement(const ThreadPlacementPolicy& policy) {
+            m_thread_placement_requested = true;
+            m_thread_placement_policy = policy;
+        }
+
+        /// \brief Returns the configured thread placement policy.
+        const ThreadPlacementPolicy& thread_placement() const {
+            return m_thread_placement_policy;
+        }
+
+        /// \brief Returns the threads placed during the run so far; safe to call while the run is active.
+        std::vector<ThreadAssignment> thread_assignments() const {
+            std::shared_ptr<ThreadPlacement> placement;
+            {
+                std::lock_guard<std::mutex> lock(m_placement_mutex);
+                placement = m_thread_placement;
+            }
+            return placement ? placement->assignments() : std::vector<ThreadAssignment>();
+        }
+
+        /// \brief Sets the longest wait between initialization passes.
+        ///
+        /// Must be called before `run_for_exit_code()`.
+        /// \param interval Nanosecond-resolution interval; defaults to `CONSOLIX_INIT_POLL_INTERVAL_MS`.
+        void set_init_poll_interval(std::chrono::nanoseconds interval) {
+            m_init_poll_interval = interval;
+        }
+
+        /// \brief Returns the longest wait between initialization passes.
+        std::chrono::nanoseconds init_poll_interval() const {
+            return m_init_poll_interval;
+        }
+
+        /// \brief Makes the run block in an epoll `Reactor` between passes.
+        ///
+        /// Must be called before `run_for_exit_code()`. The reactor is registered in the
+        /// manager's `ServiceLocator`, so components can add descriptors and timers in
+        /// `initialize()`. `LoopWakeService` wake requests and stop signals interrupt the
+        /// reactor wait. The idle policy is not used in reactor mode. A `Reactor` already
+        /// registered in that locator is used instead of a new one, with its descriptors.
+        /// \return `true` if reactor mode is available on this platform.
+        bool enable_reactor() {
+#           if defined(__linux__)
+            m_reactor_requested = true;
+            return true;
+#           else
+            return false;
+#           endif
+        }
+
+        /// \brief Reads signals through a `SignalFdService` in the reactor (implies reactor mode).
+        ///
+        /// Must be called before `run_for_exit_code()`. The service is started on the
+        /// runner thread, so its signals are blocked there and read from the descriptor;
+        /// termination signals request stop with the signal number as exit code, other
+        /// signals go to `IComponentManager::dispatch_signal()` on the loop thread. The
+        /// service is stopped after cleanup.
+        /// \param service Service with a custom signal set; `nullptr` uses the default set.
+        /// \return `true` if signalfd mode is available on this platform.
+        bool enable_signalfd(std::shared_ptr<SignalFdService> service = std::shared_ptr<SignalFdService>()) {
+            if (!enable_reactor()) {
+                return false;
+            }
+            m_signal_fd = service ? std::move(service) : std::make_shared<SignalFdService>();
+            return true;
+        }
+
+        /// \brief Checks whether reactor mode was requested and is available.
+        bool reactor_enabled() const {
+            return m_reactor_requested;
+        }
+
+#       if defined(__linux__)
+        /// \brief Returns the reactor of the current or last run.
+        /// \return The reactor, or `nullptr` before the run starts or without reactor mode.
+        std::shared_ptr<Reactor> reactor() const {
+            std::lock_guard<std::mutex> lock(m_loop_wake_mutex);
+            return m_reactor;
+        }
+#       endif
+
+        /// \brief Returns the shutdown timings collected during cleanup.
+        /// \return Copy of the manager's report; empty if the manager keeps none.
+        ShutdownReport shutdown_report() const {
+            std::lock_guard<std::mutex> lock(m_shutdown_mutex);
+            return m_shutdown_report;
+        }
+
         /// \brief Requests the runner to stop and return the provided exit code.
         /// \param exit_code Exit code to return and pass to component shutdown.
         void request_stop(int exit_code = 0) {
@@ -118,7 +385,7 @@ namespace consolix {
         /// \return `true` if cleanup completed before the timeout.
         bool request_forced_stop(
                 int exit_code,
-                std::chrono::milliseconds timeout) {
+                std::chrono::nanoseconds timeout) {
             request_stop(exit_code);
             if (is_shutdown_complete()) {
                 return true;
@@ -170,7 +437,7 @@ namespace consolix {
         /// \return `true` if an active runner completed cleanup before timeout.
         static bool request_current_forced_stop(
                 int exit_code,
-                std::chrono::milliseconds timeout) {
+                std::chrono::nanoseconds timeout) {
             ConsoleApplicationRunner* runner = current_runner().load();
             if (!runner) {
                 return false;
@@ -193,23 +460,57 @@ namespace consolix {
                 current_runner().store(m_previous);
             }
 
+            bool has_previous() const {
+                return m_previous != nullptr;
+            }
+
         private:
             ConsoleApplicationRunner* m_previous;
         };
 
-        AppComponentManager& m_manager;
+        IComponentManager&  m_manager;
         std::atomic<bool>   m_has_run{false};
         std::atomic<bool>   m_running{false};
         std::atomic<bool>   m_stopping{false};
         std::atomic<bool>   m_cleanup{false};
         std::atomic<bool>   m_shutdown_complete{false};
         std::atomic<int>    m_requested_exit_code{0};
-        std::mutex          m_shutdown_mutex;
+        mutable std::mutex  m_shutdown_mutex;
+        ShutdownReport      m_shutdown_report;
         std::condition_variable m_shutdown_complete_cv;
+        mutable std::mutex  m_loop_wake_mutex;
         std::weak_ptr<LoopWakeService> m_loop_wake_service;
-
-        void setup_signal_handlers() {
-            reset_signal_state();
+        bool                m_reactor_requested{false};
+        std::shared_ptr<SignalFdService> m_signal_fd;
+        std::shared_ptr<TimerService> m_timers;
+#       if defined(__linux__)
+        std::shared_ptr<Reactor> m_reactor;
+#       endif
+        IdlePolicy          m_idle_policy;
+        bool                m_idle{false};
+        std::chrono::steady_clock::time_point m_idle_since{};
+        std::chrono::microseconds m_next_park{0};
+        std::chrono::nanoseconds m_init_poll_interval{default_init_poll_interval()};
+        bool                m_busy_poll_requested{false};
+        int                 m_busy_poll_cpu{-1};
+        std::uint32_t       m_busy_poll_yield_every{0};
+        mutable std::mutex  m_busy_poll_mutex;
+        BusyPollReport      m_busy_poll_report;
+        RealtimePolicy      m_realtime_policy;
+        std::unique_ptr<ScopedRealtime> m_realtime;
+        mutable std::mutex  m_realtime_mutex;
+        RealtimeReport      m_realtime_report;
+        bool                m_thread_placement_requested{false};
+        ThreadPlacementPolicy m_thread_placement_policy;
+        mutable std::mutex  m_placement_mutex;
+        std::shared_ptr<ThreadPlacement> m_thread_placement; ///< Written under `m_placement_mutex`.
+        std::unique_ptr<ScopedCpuPin> m_loop_pin; ///< Loop thread affinity: off the anchor, then on it.
+
+        void setup_signal_handlers(bool reset_state) {
+            // A concurrently running runner may not have observed a pending signal yet.
+            if (reset_state) {
+                reset_signal_state();
+            }
 #           if defined(_WIN32) || defined(_WIN64)
             SetConsoleCtrlHandler(console_handler, TRUE);
             std::signal(SIGINT, signal_handler);
@@ -227,23 +528,488 @@ namespace consolix {
 #           endif
         }
 
-        void initialize_components() {
-            while (!stop_requested() && !m_manager.initialize()) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        void setup_loop_wake_service() {
+            ServiceLocator& locator = m_manager.service_locator();
+            auto service = locator.find_service<LoopWakeService>();
+            if (!service) {
+                locator.register_service<LoopWakeService>();
+                service = locator.find_service<LoopWakeService>();
             }
+            std::lock_guard<std::mutex> lock(m_loop_wake_mutex);
+            m_loop_wake_service = service;
         }
 
-        void setup_loop_wake_service() {
-            auto service = ServiceLocator::get_instance().find_service<LoopWakeService>();
+        /// \brief Registers the timer service unless the application provided one and
+        /// makes earlier timers wake the loop.
+        void setup_timer_service() {
+            ServiceLocator& locator = m_manager.service_locator();
+            m_timers = locator.find_service<TimerService>();
+            if (!m_timers) {
+                locator.register_service<TimerService>();
+                m_timers = locator.find_service<TimerService>();
+            }
+            std::weak_ptr<LoopWakeService> weak_service = loop_wake_service();
+            m_timers->set_wake_callback([weak_service]() {
+                if (std::shared_ptr<LoopWakeService> service = weak_service.lock()) {
+                    service->wake_all();
+                }
+            });
+        }
+
+        /// \brief Returns the next timer expiry, or `time_point::max()` without timers.
+        std::chrono::steady_clock::time_point next_timer_expiry() const {
+            return m_timers ? m_timers->next_expiry() : std::chrono::steady_clock::time_point::max();
+        }
+
+        /// \brief Bounds a wait deadline by the next timer expiry; `min()` stays "no wait".
+        std::chrono::steady_clock::time_point bound_by_timers(std::chrono::steady_clock::time_point deadline) const {
+            if (deadline == std::chrono::steady_clock::time_point::min()) {
+                return deadline;
+            }
+            return std::min(deadline, next_timer_expiry());
+        }
+
+        void advance_timers() {
+            if (m_timers) {
+                m_timers->advance();
+            }
+        }
+
+        /// \brief Next timer expiry cached by a loop, with the wake generation it was read at.
+        struct TimerDeadline {
+            LoopWakeService::Generation           generation{0};
+            std::chrono::steady_clock::time_point expiry{std::chrono::steady_clock::time_point::min()};
+        };
+
+        /// \brief Runs due timers without taking the timer lock on passes where none is due.
+        ///
+        /// Scheduling a timer earlier than the next expiry wakes the loop, so the cached
+        /// expiry only needs a refresh after a generation change or once it has passed.
+        /// Without a wake service nothing signals such a change, so timers advance every pass.
+        void advance_due_timers(LoopWakeService* service, TimerDeadline& cached) {
+            typedef std::chrono::steady_clock Clock;
+            if (!m_timers) {
+                return;
+            }
             if (!service) {
-                ServiceLocator::get_instance().register_service<LoopWakeService>();
-                service = ServiceLocator::get_instance().find_service<LoopWakeService>();
+                m_timers->advance();
+                return;
             }
-            m_loop_wake_service = service;
+            const LoopWakeService::Generation generation = service->generation();
+            if (generation != cached.generation) {
+                cached.generation = generation;
+                cached.expiry = m_timers->next_expiry();
+            }
+            if (cached.expiry != Clock::time_point::max() && Clock::now() >= cached.expiry) {
+                m_timers->advance();
+                cached.expiry = m_timers->next_expiry();
+            }
+        }
+
+        /// \brief Registers the topology and placement services for the run.
+        ///
+        /// With an anchor, the loop thread is also kept off it until `pin_loop_thread()`,
+        /// so threads started while components initialize, including ones created by other
+        /// libraries, inherit an affinity without the anchor.
+        void setup_thread_placement() {
+            if (!m_thread_placement_requested) {
+                return;
+            }
+            ServiceLocator& locator = m_manager.service_locator();
+            std::shared_ptr<ThreadPlacement> placement = locator.find_service<ThreadPlacement>();
+            if (!placement) {
+                std::shared_ptr<CpuTopology> topology = locator.find_service<CpuTopology>();
+                if (!topology) {
+                    locator.register_service<CpuTopology>();
+                    topology = locator.find_service<CpuTopology>();
+                }
+                ThreadPlacementPolicy policy = m_thread_placement_policy;
+                if (policy.anchor() < 0 && m_busy_poll_requested) {
+                    policy.set_anchor(m_busy_poll_cpu);
+                }
+                placement = std::make_shared<ThreadPlacement>(policy, *topology);
+                locator.register_service<ThreadPlacement>([placement]() {
+                    return placement;
+                });
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_placement_mutex);
+                m_thread_placement = placement;
+            }
+
+            const int anchor = placement->policy().anchor();
+            if (!placement->policy().enabled() || !placement->topology().find(anchor)) {
+                return;
+            }
+            std::vector<int> others;
+            for (const CpuInfo& cpu : placement->topology().cpus()) {
+                if (cpu.id != anchor) {
+                    others.push_back(cpu.id);
+                }
+            }
+            m_loop_pin.reset(new ScopedCpuPin(others));
+        }
+
+        /// \brief Pins the loop thread to the placement anchor unless busy-poll mode pins it.
+        void pin_loop_thread() {
+            if (!m_thread_placement) {
+                return;
+            }
+            const int anchor = m_thread_placement->policy().anchor();
+            if (!m_thread_placement->policy().enabled() || anchor < 0 ||
+                (m_busy_poll_requested && m_busy_poll_cpu >= 0)) {
+                return;
+            }
+            m_loop_pin.reset(); // Restore the original affinity first, so it is what cleanup restores.
+            m_loop_pin.reset(new ScopedCpuPin(anchor));
+#           if CONSOLIX_USE_LOGIT == 1
+            if (!m_loop_pin->pinned()) {
+                LOGIT_PRINT_WARN("Loop thread could not be pinned to CPU ", anchor);
+            }
+#           endif
+        }
+
+        /// \brief Applies the real-time policy on the loop thread and publishes the report.
+        void setup_realtime() {
+            if (!m_realtime_policy.enabled()) {
+                return;
+            }
+            m_realtime.reset(new ScopedRealtime(m_realtime_policy));
+            const RealtimeReport& report = m_realtime->report();
+#           if CONSOLIX_USE_LOGIT == 1
+            log_realtime_setting("Real-time scheduling", report.scheduler);
+            log_realtime_setting("Memory locking", report.memory_lock);
+            log_realtime_setting("Stack prefault", report.stack_prefault);
+            log_realtime_setting("Heap prefault", report.heap_prefault);
+            log_realtime_setting("Disabling transparent huge pages", report.thp_disabled);
+#           endif
+            std::lock_guard<std::mutex> lock(m_realtime_mutex);
+            m_realtime_report = report;
+        }
+
+#       if CONSOLIX_USE_LOGIT == 1
+        static void log_realtime_setting(const char* name, const RealtimeSetting& setting) {
+            if (setting.failed()) {
+                LOGIT_PRINT_WARN(name, " was not applied: ", std::strerror(setting.error));
+            }
+        }
+#       endif
+
+        /// \brief Creates the reactor, publishes it as a service and routes wake-ups to it.
+        void setup_reactor() {
+#           if defined(__linux__)
+            if (!m_reactor_requested) {
+                return;
+            }
+            // A reactor registered by the application keeps the descriptors added to it.
+            ServiceLocator& locator = m_manager.service_locator();
+            std::shared_ptr<Reactor> reactor = locator.find_service<Reactor>();
+            if (!reactor) {
+                reactor = std::make_shared<Reactor>();
+                locator.register_service<Reactor>([reactor]() {
+                    return reactor;
+                });
+            }
+            reactor->bind_signal_wakeups();
+            if (m_signal_fd && m_signal_fd->start()) {
+                std::shared_ptr<SignalFdService> signal_fd = m_signal_fd;
+                reactor->add_fd(signal_fd->fd(), EPOLLIN, [this, signal_fd](std::uint32_t) {
+                    signal_fd->read_pending([this, &signal_fd](int signal_number) {
+                        if (signal_fd->terminates(signal_number)) {
+                            request_stop(signal_number);
+                        } else {
+                            m_manager.dispatch_signal(signal_number);
+                        }
+                    });
+                });
+            }
+            std::shared_ptr<LoopWakeService> service = loop_wake_service();
+            if (service && service->event_fd() >= 0) {
+                // Descriptor mode: wake_all() writes the eventfd already, and other
+                // processes may write it too, so poll it instead of chaining a notifier.
+                reactor->add_fd(service->event_fd(), EPOLLIN, [service](std::uint32_t) {
+                    service->absorb_event_fd();
+                });
+            } else if (service) {
+                service->set_notifier(reactor);
+            }
+            std::lock_guard<std::mutex> lock(m_loop_wake_mutex);
+            m_reactor = reactor;
+#           endif
+        }
+
+        /// \brief Detaches the reactor from wake and signal sources before services are cleared.
+        void teardown_reactor() {
+#           if defined(__linux__)
+            std::shared_ptr<Reactor> reactor = this->reactor();
+            if (!reactor) {
+                return;
+            }
+            reactor->unbind_signal_wakeups();
+            if (std::shared_ptr<LoopWakeService> service = loop_wake_service()) {
+                service->set_notifier(nullptr);
+                if (service->event_fd() >= 0) {
+                    reactor->remove_fd(service->event_fd());
+                }
+            }
+#           endif
+        }
+
+        /// \brief Unregisters and stops the signalfd service once cleanup has finished.
+        void stop_signal_fd() {
+            if (!m_signal_fd || !m_signal_fd->is_running()) {
+                return;
+            }
+#           if defined(__linux__)
+            if (std::shared_ptr<Reactor> reactor = this->reactor()) {
+                reactor->remove_fd(m_signal_fd->fd());
+            }
+#           endif
+            m_signal_fd->stop();
+        }
+
+        /// \brief Waits in the reactor when reactor mode is active.
+        /// \return `false` without a reactor, so the caller waits another way.
+        bool wait_in_reactor(std::chrono::nanoseconds timeout) {
+#           if defined(__linux__)
+            if (std::shared_ptr<Reactor> reactor = this->reactor()) {
+                reactor->run_once(timeout);
+                return true;
+            }
+#           else
+            (void)timeout;
+#           endif
+            return false;
+        }
+
+        /// \brief Processes passes, waiting on `LoopWakeService` and the idle policy between them.
+        template <typename IterationAction>
+        void run_polling_loop(IterationAction& iteration_action) {
+            bool observe_wakes = true;
+            const std::shared_ptr<LoopWakeService> timer_wakes = loop_wake_service();
+            TimerDeadline timer_deadline;
+            while (!stop_requested()) {
+                advance_due_timers(timer_wakes.get(), timer_deadline);
+                std::shared_ptr<LoopWakeService> service;
+                LoopWakeService::Generation observed_generation = 0;
+                if (observe_wakes && (service = loop_wake_service())) {
+                    observed_generation = service->generation();
+                }
+                m_manager.process();
+                iteration_action();
+                observe_wakes = wait_between_passes(service.get(), observed_generation);
+            }
+        }
+
+        /// \brief Processes passes back to back on an optionally pinned thread.
+        /// \return `false` if busy-poll mode is not enabled, so the caller picks another loop.
+        template <typename IterationAction>
+        bool run_busy_poll_loop(IterationAction& iteration_action) {
+            typedef std::chrono::steady_clock Clock;
+            if (!m_busy_poll_requested) {
+                return false;
+            }
+
+            ScopedCpuPin pin(m_busy_poll_cpu);
+            BusyPollReport report;
+            report.cpu = m_busy_poll_cpu;
+            report.pinned = pin.pinned();
+#           if CONSOLIX_USE_LOGIT == 1
+            if (m_busy_poll_cpu >= 0 && !report.pinned) {
+                LOGIT_PRINT_WARN("Busy-poll loop could not be pinned to CPU ", m_busy_poll_cpu);
+            }
+#           endif
+            publish_busy_poll_report(report);
+
+            std::shared_ptr<LoopWakeService> service = loop_wake_service();
+            LoopWakeService::Generation observed_generation = service ? service->generation() : 0;
+            Clock::time_point timer_deadline = next_timer_expiry();
+            Clock::time_point previous_start;
+            std::uint32_t until_signal_check = 0;
+            std::uint32_t idle_passes = 0;
+            while (true) {
+                // The stop flag is a relaxed load; converting pending POSIX signals into a
+                // stop request reads more shared state, so it runs once per interval.
+                if (until_signal_check == 0) {
+                    until_signal_check = busy_poll_signal_check_interval();
+                    if (stop_requested()) {
+                        break;
+                    }
+                } else {
+                    --until_signal_check;
+                    if (m_stopping.load(std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+
+                const Clock::time_point start = Clock::now();
+                if (report.iterations != 0) {
+                    report.gaps.record(static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(start - previous_start).count()));
+                }
+                previous_start = start;
+                ++report.iterations;
+
+                // Earlier timers wake the loop, so the cached deadline only needs a refresh
+                // after a generation change or once it has passed.
+                if (service) {
+                    const LoopWakeService::Generation generation = service->generation();
+                    if (generation != observed_generation) {
+                        observed_generation = generation;
+                        timer_deadline = next_timer_expiry();
+                    }
+                }
+                if (start >= timer_deadline) {
+                    advance_timers();
+                    timer_deadline = next_timer_expiry();
+                }
+
+                m_manager.process();
+                iteration_action();
+
+                if (m_manager.reports_work() && m_manager.last_work_count() == 0) {
+                    ++idle_passes;
+                    if (m_busy_poll_yield_every != 0 && idle_passes % m_busy_poll_yield_every == 0) {
+                        std::this_thread::yield();
+                    } else {
+                        cpu_relax();
+                    }
+                } else {
+                    idle_passes = 0;
+                }
+
+                if ((report.iterations & 0xffff) == 0) {
+                    publish_busy_poll_report(report);
+                }
+            }
+            publish_busy_poll_report(report);
+            return true;
+        }
+
+        void publish_busy_poll_report(const BusyPollReport& report) {
+            std::lock_guard<std::mutex> lock(m_busy_poll_mutex);
+            m_busy_poll_report = report;
+        }
+
+        static std::uint32_t busy_poll_signal_check_interval() {
+            return 256;
+        }
+
+        /// \brief Processes passes, blocking in the reactor between them.
+        /// \return `false` if reactor mode is not active, so the caller runs the polling loop.
+        template <typename IterationAction>
+        bool run_reactor_loop(IterationAction& iteration_action) {
+#           if defined(__linux__)
+            typedef std::chrono::steady_clock Clock;
+            std::shared_ptr<Reactor> reactor = this->reactor();
+            if (!reactor) {
+                return false;
+            }
+            std::shared_ptr<LoopWakeService> service = loop_wake_service();
+            TimerDeadline timer_deadline;
+            while (!stop_requested()) {
+                advance_due_timers(service.get(), timer_deadline);
+                const LoopWakeService::Generation observed_generation = service ? service->generation() : 0;
+                m_manager.process();
+                iteration_action();
+                if (stop_requested()) {
+                    break;
+                }
+
+                // `min()` means "every pass is due", which the reactor treats as no deadline:
+                // such components run after each batch of events instead of in a busy loop.
+                // Timers still bound the wait.
+                Clock::time_point deadline = m_manager.next_deadline();
+                if (deadline == Clock::time_point::min()) {
+                    deadline = Clock::time_point::max();
+                }
+                deadline = std::min(deadline, next_timer_expiry());
+                if (service && service->generation() != observed_generation) {
+                    reactor->run_once(std::chrono::nanoseconds::zero());
+                } else if (deadline == Clock::time_point::max()) {
+                    reactor->run_once(std::chrono::nanoseconds(-1));
+                } else {
+                    reactor->run_until(deadline);
+                }
+            }
+            return true;
+#           else
+            (void)iteration_action;
+            return false;
+#           endif
+        }
+
+        /// \brief Returns the loop wake service; safe to call from stop-requesting threads.
+        std::shared_ptr<LoopWakeService> loop_wake_service() {
+            std::lock_guard<std::mutex> lock(m_loop_wake_mutex);
+            return m_loop_wake_service.lock();
+        }
+
+        /// \brief Applies the idle policy and the manager's next deadline after a pass.
+        /// \return `true` if the next pass should observe wakes before processing.
+        bool wait_between_passes(LoopWakeService* service, LoopWakeService::Generation observed_generation) {
+            typedef std::chrono::steady_clock Clock;
+            Clock::time_point deadline = bound_by_timers(m_manager.next_deadline());
+            if (!m_idle_policy.enabled() || !m_manager.reports_work()) {
+                return wait_until_deadline(service, observed_generation, deadline);
+            }
+
+            if (m_manager.last_work_count() != 0) {
+                m_idle = false;
+                return wait_until_deadline(service, observed_generation, deadline);
+            }
+
+            const Clock::time_point now = Clock::now();
+            if (!m_idle) {
+                m_idle = true;
+                m_idle_since = now;
+                m_next_park = m_idle_policy.min_park();
+            }
+
+            const Clock::duration idle_time = now - m_idle_since;
+            if (idle_time < m_idle_policy.spin_for()) {
+                // Spin: start the next pass at once.
+            } else if (idle_time < m_idle_policy.spin_for() + m_idle_policy.yield_for()) {
+                std::this_thread::yield();
+            } else if (service) {
+                const Clock::time_point park_until = now + m_next_park;
+                if (deadline == Clock::time_point::min() || park_until < deadline) {
+                    deadline = bound_by_timers(park_until);
+                }
+                m_next_park = std::min(m_next_park * 2, m_idle_policy.max_park());
+            }
+            wait_until_deadline(service, observed_generation, deadline);
+            return true;
+        }
+
+        /// \brief Waits until `deadline` when it lies in the future.
+        /// \return `true` if there was a deadline, so the next pass should observe wakes.
+        bool wait_until_deadline(
+                LoopWakeService* service,
+                LoopWakeService::Generation observed_generation,
+                std::chrono::steady_clock::time_point deadline) {
+            typedef std::chrono::steady_clock Clock;
+            if (deadline == Clock::time_point::min()) {
+                return false;
+            }
+
+            const Clock::time_point now = Clock::now();
+            if (deadline <= now || stop_requested()) {
+                return true;
+            }
+
+            const Clock::time_point limit = now + std::chrono::milliseconds(CONSOLIX_SCHEDULE_MAX_WAIT_MS);
+            const Clock::time_point wait_until = deadline < limit ? deadline : limit;
+            if (service) {
+                service->wait_until_change(observed_generation, wait_until);
+            } else {
+                sleep_until_precise(wait_until);
+            }
+            return true;
         }
 
         void wake_loop_waiters() {
-            if (auto service = m_loop_wake_service.lock()) {
+            if (auto service = loop_wake_service()) {
                 service->wake_all();
             }
         }
@@ -265,7 +1031,7 @@ namespace consolix {
             }
         }
 
-        bool wait_for_shutdown(std::chrono::milliseconds timeout) {
+        bool wait_for_shutdown(std::chrono::nanoseconds timeout) {
             std::unique_lock<std::mutex> lock(m_shutdown_mutex);
             return m_shutdown_complete_cv.wait_for(
                 lock,
@@ -297,8 +1063,17 @@ namespace consolix {
             LOGIT_PRINT_INFO("Cleaning up application for exit code: ", exit_code);
 #           endif
 
+            bool shutdown_timed_out = false;
+            bool shutdown_running = false;
             try {
                 m_manager.shutdown(exit_code);
+                if (const ShutdownReport* report = m_manager.shutdown_report()) {
+                    log_shutdown_report(*report);
+                    shutdown_timed_out = report->timed_out();
+                    std::lock_guard<std::mutex> lock(m_shutdown_mutex);
+                    m_shutdown_report = *report;
+                }
+                shutdown_running = m_manager.running_shutdown_tasks() != 0;
             } catch (const std::exception& e) {
                 cleanup_failed = true;
                 log_fatal_exception("Shutdown error: ", e);
@@ -307,23 +1082,40 @@ namespace consolix {
                 log_fatal_message("Shutdown error: unknown exception");
             }
 
-            try {
-                ServiceLocator::get_instance().clear_all();
-            } catch (const std::exception& e) {
-                cleanup_failed = true;
-                log_fatal_exception("Service cleanup error: ", e);
-            } catch (...) {
-                cleanup_failed = true;
-                log_fatal_message("Service cleanup error: unknown exception");
+            teardown_reactor();
+            if (m_timers) {
+                m_timers->set_wake_callback(std::function<void()>());
+                m_timers.reset();
             }
+            m_realtime.reset();
+            m_loop_pin.reset();
+
+            // Components still shutting down on helper threads may use services and
+            // the logger, so both are left alive; the process exit reclaims them.
+            if (shutdown_running) {
+                log_fatal_message("Component shutdowns still running: services and logger left alive");
+            } else {
+                try {
+                    m_manager.service_locator().clear_all();
+                } catch (const std::exception& e) {
+                    cleanup_failed = true;
+                    log_fatal_exception("Service cleanup error: ", e);
+                } catch (...) {
+                    cleanup_failed = true;
+                    log_fatal_message("Service cleanup error: unknown exception");
+                }
 
-#           if CONSOLIX_USE_LOGIT == 1
-            LOGIT_SHUTDOWN();
-#           endif
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_SHUTDOWN();
+#               endif
+            }
 
             if (cleanup_failed && exit_code == 0) {
                 return fatal_exit_code();
             }
+            if (shutdown_timed_out && exit_code == 0) {
+                return CONSOLIX_SHUTDOWN_TIMEOUT_EXIT_CODE;
+            }
             return exit_code;
         }
 
@@ -348,6 +1140,10 @@ namespace consolix {
             return -1;
         }
 
+        static std::chrono::nanoseconds default_init_poll_interval() {
+            return std::chrono::milliseconds(CONSOLIX_INIT_POLL_INTERVAL_MS);
+        }
+
         static void log_fatal_exception(const char* prefix, const std::exception& e) {
 #           if CONSOLIX_USE_LOGIT == 1
             LOGIT_PRINT_FATAL(prefix, e.what());
@@ -357,6 +1153,25 @@ namespace consolix {
 #           endif
         }
 
+        static void log_shutdown_report(const ShutdownReport& report) {
+#           if CONSOLIX_USE_LOGIT == 1
+            for (const auto& component : report.components) {
+                if (component.timed_out) {
+                    LOGIT_PRINT_ERROR("Shutdown [", component.index, "] ", component.name,
+                                      ": timed out after ", component.duration.count(), " us");
+                } else if (component.skipped) {
+                    LOGIT_PRINT_ERROR("Shutdown [", component.index, "] ", component.name, ": skipped");
+                } else {
+                    LOGIT_PRINT_INFO("Shutdown [", component.index, "] ", component.name,
+                                     ": ", component.duration.count(), " us");
+                }
+            }
+            LOGIT_PRINT_INFO("Shutdown took ", report.total.count(), " us");
+#           else
+            (void)report;
+#           endif
+        }
+
         static void log_fatal_message(const char* message) {
 #           if CONSOLIX_USE_LOGIT == 1
             LOGIT_PRINT_FATAL(message);
@@ -374,6 +1189,9 @@ namespace consolix {
             pending_signal_code() = static_cast<std::sig_atomic_t>(exit_code);
             signal_stop_requested() = 1;
             PosixSignalWakeService::notify_signal_handler();
+#           if defined(__linux__)
+            Reactor::notify_signal_handler();
+#           endif
         }
 
         static void reset_signal_state() {
@@ -0,0 +1,280 @@
+#pragma once
+#ifndef _CONSOLIX_CPU_TOPOLOGY_HPP_INCLUDED
+#define _CONSOLIX_CPU_TOPOLOGY_HPP_INCLUDED
+
+/// \file CpuTopology.hpp
+/// \brief Logical CPUs, SMT siblings, caches and NUMA nodes read from sysfs.
+/// \ingroup Core
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace consolix {
+
+    /// \struct CpuCache
+    /// \brief One cache level as seen by a logical CPU.
+    struct CpuCache {
+        int              level{0};    ///< Cache level, `1` for L1.
+        std::string      type;        ///< `Data`, `Instruction` or `Unified`.
+        std::size_t      size{0};     ///< Size in bytes.
+        std::vector<int> shared_cpus; ///< Logical CPUs sharing this cache, ascending.
+    };
+
+    /// \struct CpuInfo
+    /// \brief Placement-relevant facts about one online logical CPU.
+    struct CpuInfo {
+        int                   id{-1};       ///< Logical CPU index.
+        int                   core{-1};     ///< Core id within the package.
+        int                   package{-1};  ///< Physical package (socket) id.
+        int                   node{-1};     ///< NUMA node, or `-1` when unknown.
+        std::vector<int>      smt_siblings; ///< CPUs on the same core, including this one.
+        std::vector<CpuCache> caches;       ///< Caches in sysfs order, usually L1d, L1i, L2, L3.
+    };
+
+    /// \class CpuTopology
+    /// \brief Snapshot of the machine's CPU topology.
+    ///
+    /// On Linux the constructor reads `cpu/online`, each CPU's `topology/` and
+    /// `cache/index*/` directories, and `node/node*/cpulist` below the sysfs root.
+    /// When sysfs is unavailable, as on other platforms, the topology falls back to
+    /// `get_cpu_count()` CPUs with one core each, no cache data and unknown nodes;
+    /// `from_sysfs()` tells which case applies.
+    ///
+    /// The topology is immutable after construction, so it can be registered as a
+    /// service and shared between threads.
+    class CpuTopology {
+    public:
+        /// \brief Reads the topology.
+        /// \param sysfs_root Directory holding `cpu/` and `node/`; tests point it at a copy.
+        explicit CpuTopology(const std::string& sysfs_root = "/sys/devices/system") {
+            std::string online;
+            if (read_line(sysfs_root + "/cpu/online", online)) {
+                for (int id : parse_cpu_list(online)) {
+                    m_cpus.push_back(read_cpu(sysfs_root, id));
+                }
+            }
+            m_from_sysfs = !m_cpus.empty();
+            if (!m_from_sysfs) {
+                const int count = get_cpu_count() > 0 ? get_cpu_count() : 1;
+                for (int id = 0; id < count; ++id) {
+                    CpuInfo cpu;
+                    cpu.id = id;
+                    cpu.core = id;
+                    cpu.package = 0;
+                    cpu.smt_siblings.push_back(id);
+                    m_cpus.push_back(cpu);
+                }
+                return;
+            }
+
+            std::string nodes;
+            if (read_line(sysfs_root + "/node/online", nodes)) {
+                for (int node : parse_cpu_list(nodes)) {
+                    std::string cpus;
+                    if (!read_line(sysfs_root + "/node/node" + std::to_string(node) + "/cpulist", cpus)) {
+                        continue;
+                    }
+                    m_nodes.push_back(node);
+                    for (int id : parse_cpu_list(cpus)) {
+                        if (CpuInfo* cpu = find_mutable(id)) {
+                            cpu->node = node;
+                        }
+                    }
+                }
+            }
+        }
+
+        /// \brief Returns whether the data came from sysfs rather than the fallback.
+        bool from_sysfs() const {
+            return m_from_sysfs;
+        }
+
+        /// \brief Returns the online CPUs in ascending order.
+        const std::vector<CpuInfo>& cpus() const {
+            return m_cpus;
+        }
+
+        /// \brief Returns the NUMA node ids in ascending order; empty when unknown.
+        const std::vector<int>& nodes() const {
+            return m_nodes;
+        }
+
+        /// \brief Finds an online CPU.
+        /// \return The CPU, or `nullptr` if `id` is not online.
+        const CpuInfo* find(int id) const {
+            for (const CpuInfo& cpu : m_cpus) {
+                if (cpu.id == id) {
+                    return &cpu;
+                }
+            }
+            return nullptr;
+        }
+
+        /// \brief Returns the number of physical cores.
+        std::size_t core_count() const {
+            std::vector<std::pair<int, int>> cores;
+            for (const CpuInfo& cpu : m_cpus) {
+                cores.push_back(std::make_pair(cpu.package, cpu.core));
+            }
+            std::sort(cores.begin(), cores.end());
+            return static_cast<std::size_t>(std::unique(cores.begin(), cores.end()) - cores.begin());
+        }
+
+        /// \brief Checks whether two different CPUs are hardware threads of one core.
+        bool smt_siblings(int a, int b) const {
+            const CpuInfo* cpu = find(a);
+            return a != b && cpu && contains(cpu->smt_siblings, b);
+        }
+
+        /// \brief Returns the highest-level data or unified cache of a CPU.
+        /// \return The cache, or `nullptr` if unknown.
+        const CpuCache* last_level_cache(int id) const {
+            const CpuInfo* cpu = find(id);
+            const CpuCache* result = nullptr;
+            if (cpu) {
+                for (const CpuCache& cache : cpu->caches) {
+                    if (cache.type != "Instruction" && (!result || cache.level > result->level)) {
+                        result = &cache;
+                    }
+                }
+            }
+            return result;
+        }
+
+        /// \brief Checks whether two CPUs share their last-level cache.
+        bool share_last_level_cache(int a, int b) const {
+            const CpuCache* cache = last_level_cache(a);
+            return cache && contains(cache->shared_cpus, b);
+        }
+
+        /// \brief Returns the NUMA node of a CPU, or `-1` when unknown.
+        int node_of(int id) const {
+            const CpuInfo* cpu = find(id);
+            return cpu ? cpu->node : -1;
+        }
+
+        /// \brief Returns the online CPUs of a NUMA node.
+        std::vector<int> node_cpus(int node) const {
+            std::vector<int> result;
+            for (const CpuInfo& cpu : m_cpus) {
+                if (cpu.node == node) {
+                    result.push_back(cpu.id);
+                }
+            }
+            return result;
+        }
+
+        /// \brief Parses a sysfs CPU list such as `0-3,8,10-11`.
+        /// \return The listed ids in ascending order; malformed ranges are skipped.
+        static std::vector<int> parse_cpu_list(const std::string& text) {
+            std::vector<int> result;
+            std::size_t position = 0;
+            while (position < text.size()) {
+                std::size_t end = text.find(',', position);
+                if (end == std::string::npos) {
+                    end = text.size();
+                }
+                const std::string range = text.substr(position, end - position);
+                const std::size_t dash = range.find('-');
+                char* tail = nullptr;
+                const long first = std::strtol(range.c_str(), &tail, 10);
+                if (tail != range.c_str() && first >= 0) {
+                    const long last = dash == std::string::npos ?
+                        first : std::strtol(range.c_str() + dash + 1, nullptr, 10);
+                    for (long id = first; id <= last && id - first < 65536; ++id) {
+                        result.push_back(static_cast<int>(id));
+                    }
+                }
+                position = end + 1;
+            }
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+            return result;
+        }
+
+        /// \brief Parses a sysfs cache size such as `32K` or `8M` into bytes.
+        static std::size_t parse_size(const std::string& text) {
+            char* tail = nullptr;
+            const unsigned long long value = std::strtoull(text.c_str(), &tail, 10);
+            switch (tail ? *tail : '\0') {
+            case 'K': return static_cast<std::size_t>(value << 10);
+            case 'M': return static_cast<std::size_t>(value << 20);
+            case 'G': return static_cast<std::size_t>(value << 30);
+            default:  return static_cast<std::size_t>(value);
+            }
+        }
+
+    private:
+        std::vector<CpuInfo> m_cpus;
+        std::vector<int>     m_nodes;
+        bool                 m_from_sysfs{false};
+
+        static bool read_line(const std::string& path, std::string& line) {
+            std::ifstream file(path.c_str());
+            return file && std::getline(file, line) && !line.empty();
+        }
+
+        static int read_int(const std::string& path, int fallback) {
+            std::string line;
+            return read_line(path, line) ? std::atoi(line.c_str()) : fallback;
+        }
+
+        static bool contains(const std::vector<int>& ids, int id) {
+            return std::binary_search(ids.begin(), ids.end(), id);
+        }
+
+        static CpuInfo read_cpu(const std::string& root, int id) {
+            const std::string base = root + "/cpu/cpu" + std::to_string(id);
+            CpuInfo cpu;
+            cpu.id = id;
+            cpu.core = read_int(base + "/topology/core_id", id);
+            cpu.package = read_int(base + "/topology/physical_package_id", 0);
+
+            std::string siblings;
+            if (read_line(base + "/topology/thread_siblings_list", siblings)) {
+                cpu.smt_siblings = parse_cpu_list(siblings);
+            }
+            if (!contains(cpu.smt_siblings, id)) {
+                cpu.smt_siblings.push_back(id);
+                std::sort(cpu.smt_siblings.begin(), cpu.smt_siblings.end());
+            }
+
+            for (int index = 0;; ++index) {
+                const std::string cache_base = base + "/cache/index" + std::to_string(index);
+                CpuCache cache;
+                cache.level = read_int(cache_base + "/level", 0);
+                if (cache.level == 0) {
+                    break;
+                }
+                std::string value;
+                if (read_line(cache_base + "/type", value)) {
+                    cache.type = value;
+                }
+                if (read_line(cache_base + "/size", value)) {
+                    cache.size = parse_size(value);
+                }
+                if (read_line(cache_base + "/shared_cpu_list", value)) {
+                    cache.shared_cpus = parse_cpu_list(value);
+                }
+                cpu.caches.push_back(cache);
+            }
+            return cpu;
+        }
+
+        CpuInfo* find_mutable(int id) {
+            for (CpuInfo& cpu : m_cpus) {
+                if (cpu.id == id) {
+                    return &cpu;
+                }
+            }
+            return nullptr;
+        }
+    }; // CpuTopology
+
+} // namespace consolix
+
+#endif // _CONSOLIX_CPU_TOPOLOGY_HPP_INCLUDED
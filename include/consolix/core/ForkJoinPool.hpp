@@ -0,0 +1,216 @@
+#pragma once
+#ifndef _CONSOLIX_FORK_JOIN_POOL_HPP_INCLUDED
+#define _CONSOLIX_FORK_JOIN_POOL_HPP_INCLUDED
+
+/// \file ForkJoinPool.hpp
+/// \brief Bounded thread pool that runs indexed task batches to completion.
+/// \ingroup Core
+
+#include "ThreadPlacement.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace consolix {
+
+    /// \class ForkJoinPool
+    /// \brief Runs `task(i)` for every index of a batch on a fixed set of worker threads.
+    ///
+    /// `run()` publishes a batch, lets the workers and the calling thread claim indices
+    /// from a shared atomic counter, and returns once every index has finished. If tasks
+    /// throw, all other tasks still run and the exception of the lowest index is rethrown,
+    /// so error reporting does not depend on thread timing.
+    ///
+    /// One batch runs at a time; `run()` must not be called concurrently or from a task.
+    ///
+    /// Workers are named `cx-worker-<slot>` and, when a `ThreadPlacement` is given,
+    /// pinned by it as they start.
+    class ForkJoinPool {
+    public:
+        /// \brief Task signature: receives the index within the batch.
+        typedef std::function<void(std::size_t)> Task;
+
+        /// \brief Starts the worker threads.
+        /// \param worker_count Number of threads besides the caller of `run()`.
+        /// \param placement Placement applied to each worker; null only names them.
+        explicit ForkJoinPool(
+                std::size_t worker_count,
+                std::shared_ptr<ThreadPlacement> placement = std::shared_ptr<ThreadPlacement>()) {
+            m_workers.reserve(worker_count);
+            for (std::size_t i = 0; i < worker_count; ++i) {
+                m_workers.push_back(std::thread(&ForkJoinPool::worker_loop, this, i + 1, placement));
+            }
+        }
+
+        /// \brief Stops and joins the worker threads.
+        ~ForkJoinPool() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_job_condition.notify_all();
+            for (auto& worker : m_workers) {
+                worker.join();
+            }
+        }
+
+        ForkJoinPool(const ForkJoinPool&) = delete;
+        ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+
+        /// \brief Returns the number of worker threads.
+        std::size_t worker_count() const {
+            return m_workers.size();
+        }
+
+        /// \brief Returns the slot of the calling thread in this pool.
+        /// \return `1 ... worker_count()` on a worker of this pool, `0` on any other thread.
+        std::size_t current_worker_slot() const {
+            const WorkerSlot& slot = current_slot();
+            return slot.pool == this ? slot.index : 0;
+        }
+
+        /// \brief Runs `task(0) ... task(task_count - 1)` and waits for all of them.
+        /// \param task_count Number of indices in the batch.
+        /// \param task Callable invoked once per index.
+        /// \throws Rethrows the exception of the lowest failing index.
+        void run(std::size_t task_count, const Task& task) {
+            if (task_count == 0) {
+                return;
+            }
+
+            std::vector<std::exception_ptr> errors(task_count);
+            if (m_workers.empty() || task_count == 1) {
+                for (std::size_t i = 0; i < task_count; ++i) {
+                    run_task(task, errors, i);
+                }
+                rethrow_first(errors);
+                return;
+            }
+
+            Job job;
+            job.task = &task;
+            job.errors = &errors;
+            job.count = task_count;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_next.store(0, std::memory_order_relaxed);
+                m_remaining.store(task_count, std::memory_order_relaxed);
+                m_job = job;
+                ++m_epoch;
+            }
+            m_job_condition.notify_all();
+
+            work_on(job);
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_done_condition.wait(lock, [this]() {
+                    return m_remaining.load(std::memory_order_acquire) == 0 && m_busy_workers == 0;
+                });
+                m_job = Job();
+            }
+            rethrow_first(errors);
+        }
+
+    private:
+        struct WorkerSlot {
+            const ForkJoinPool* pool{nullptr};
+            std::size_t         index{0};
+        };
+
+        struct Job {
+            const Task*                      task{nullptr};
+            std::vector<std::exception_ptr>* errors{nullptr};
+            std::size_t                      count{0};
+        };
+
+        std::vector<std::thread> m_workers;
+        std::mutex               m_mutex;
+        std::condition_variable  m_job_condition;
+        std::condition_variable  m_done_condition;
+        Job                      m_job;
+        std::uint64_t            m_epoch{0};
+        std::size_t              m_busy_workers{0};
+        bool                     m_stop{false};
+        std::atomic<std::size_t> m_next{0};
+        std::atomic<std::size_t> m_remaining{0};
+
+        static WorkerSlot& current_slot() {
+            static thread_local WorkerSlot slot;
+            return slot;
+        }
+
+        void worker_loop(std::size_t index, std::shared_ptr<ThreadPlacement> placement) {
+            const PlacedThread placed = place_current_thread(placement, "cx-worker-" + std::to_string(index));
+            placement.reset();
+            current_slot().pool = this;
+            current_slot().index = index;
+            std::uint64_t seen_epoch = 0;
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (;;) {
+                m_job_condition.wait(lock, [this, seen_epoch]() {
+                    return m_stop || m_epoch != seen_epoch;
+                });
+                if (m_stop) {
+                    return;
+                }
+                seen_epoch = m_epoch;
+                if (!m_job.task) {
+                    continue;
+                }
+
+                const Job job = m_job;
+                ++m_busy_workers;
+                lock.unlock();
+                work_on(job);
+                lock.lock();
+                --m_busy_workers;
+                if (m_busy_workers == 0) {
+                    m_done_condition.notify_all();
+                }
+            }
+        }
+
+        void work_on(const Job& job) {
+            for (;;) {
+                const std::size_t index = m_next.fetch_add(1, std::memory_order_relaxed);
+                if (index >= job.count) {
+                    return;
+                }
+                run_task(*job.task, *job.errors, index);
+                if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_done_condition.notify_all();
+                }
+            }
+        }
+
+        static void run_task(const Task& task, std::vector<std::exception_ptr>& errors, std::size_t index) {
+            try {
+                task(index);
+            } catch (...) {
+                errors[index] = std::current_exception();
+            }
+        }
+
+        static void rethrow_first(const std::vector<std::exception_ptr>& errors) {
+            for (const auto& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+    }; // ForkJoinPool
+
+} // namespace consolix
+
+#endif // _CONSOLIX_FORK_JOIN_POOL_HPP_INCLUDED
@@ -0,0 +1,121 @@
+#pragma once
+#ifndef _CONSOLIX_IDLE_POLICY_HPP_INCLUDED
+#define _CONSOLIX_IDLE_POLICY_HPP_INCLUDED
+
+/// \file IdlePolicy.hpp
+/// \brief Describes how the runner backs off when components report no work.
+/// \ingroup Core
+
+#include <chrono>
+
+namespace consolix {
+
+    /// \class IdlePolicy
+    /// \brief Adaptive spin, yield and park backoff for `ConsoleApplicationRunner`.
+    ///
+    /// The policy applies when the component manager reports work through
+    /// `IWorkReporter`. After the first pass without work the runner keeps spinning
+    /// for `spin_for()`, then yields its time slice until `yield_for()` has also
+    /// elapsed, and then parks on `LoopWakeService`. Park times start at `min_park()`
+    /// and double on every idle pass up to `max_park()`. Any pass with work resets
+    /// the backoff, and `consolix::wake_loop()` ends a park immediately.
+    ///
+    /// The two budgets map to the usual targets: `max_park()` bounds the extra
+    /// latency for work that arrives without a wake request, and the spin and yield
+    /// windows bound how long an idle loop burns CPU before it sleeps.
+    ///
+    /// ```cpp
+    /// consolix::ConsoleApplicationRunner runner(manager);
+    /// runner.set_idle_policy(consolix::IdlePolicy::balanced());
+    /// ```
+    class IdlePolicy {
+    public:
+        /// \brief Creates a disabled policy; the runner never backs off.
+        IdlePolicy() = default;
+
+        /// \brief Returns a disabled policy.
+        static IdlePolicy disabled() {
+            return IdlePolicy();
+        }
+
+        /// \brief Creates a policy with explicit budgets.
+        /// \param spin_for Time to keep spinning after the last pass with work.
+        /// \param yield_for Additional time to yield before parking.
+        /// \param max_park Upper bound for a single park.
+        /// \param min_park First park duration; clamped to `max_park`.
+        static IdlePolicy adaptive(
+                std::chrono::microseconds spin_for,
+                std::chrono::microseconds yield_for,
+                std::chrono::microseconds max_park,
+                std::chrono::microseconds min_park = std::chrono::microseconds(50)) {
+            IdlePolicy policy;
+            policy.m_enabled = true;
+            policy.m_spin_for = spin_for;
+            policy.m_yield_for = yield_for;
+            policy.m_max_park = max_park;
+            policy.m_min_park = min_park < max_park ? min_park : max_park;
+            return policy;
+        }
+
+        /// \brief Favors wake-up latency: long spin and yield windows, parks of at most 1 ms.
+        static IdlePolicy low_latency() {
+            return adaptive(
+                std::chrono::microseconds(1000),
+                std::chrono::microseconds(10000),
+                std::chrono::microseconds(1000));
+        }
+
+        /// \brief Short spin and yield windows with parks of up to 10 ms.
+        static IdlePolicy balanced() {
+            return adaptive(
+                std::chrono::microseconds(50),
+                std::chrono::microseconds(1000),
+                std::chrono::microseconds(10000),
+                std::chrono::microseconds(100));
+        }
+
+        /// \brief Favors CPU usage: parks at once, for up to 100 ms.
+        static IdlePolicy low_cpu() {
+            return adaptive(
+                std::chrono::microseconds(0),
+                std::chrono::microseconds(0),
+                std::chrono::microseconds(100000),
+                std::chrono::microseconds(1000));
+        }
+
+        /// \brief Checks whether the runner backs off at all.
+        bool enabled() const {
+            return m_enabled;
+        }
+
+        /// \brief Returns the spin window after the last pass with work.
+        std::chrono::microseconds spin_for() const {
+            return m_spin_for;
+        }
+
+        /// \brief Returns the yield window that follows the spin window.
+        std::chrono::microseconds yield_for() const {
+            return m_yield_for;
+        }
+
+        /// \brief Returns the first park duration.
+        std::chrono::microseconds min_park() const {
+            return m_min_park;
+        }
+
+        /// \brief Returns the upper bound for a single park.
+        std::chrono::microseconds max_park() const {
+            return m_max_park;
+        }
+
+    private:
+        bool                      m_enabled{false};
+        std::chrono::microseconds m_spin_for{0};
+        std::chrono::microseconds m_yield_for{0};
+        std::chrono::microseconds m_min_park{0};
+        std::chrono::microseconds m_max_park{0};
+    }; // IdlePolicy
+
+} // namespace consolix
+
+#endif // _CONSOLIX_IDLE_POLICY_HPP_INCLUDED
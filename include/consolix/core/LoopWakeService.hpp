@@ -6,10 +6,29 @@
 /// \brief Shared wake channel for Consolix polling-loop wait components.
 /// \ingroup Core
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <stdexcept>
+#include <string>
+
+#include "../config_macros.hpp"
+#include "PreciseSleep.hpp"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <ctime>
+#include <linux/futex.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace consolix {
 
@@ -18,25 +37,244 @@ namespace consolix {
     ///
     /// The service uses a generation counter so a wake request can be observed by
     /// multiple waiters and by waiters that start just after the request was made.
+    ///
+    /// The counter is atomic: `generation()` is a plain load and `wake_all()` is one
+    /// increment plus a load of the sleeper count, so producers can wake the loop
+    /// millions of times per second. Only when a waiter is blocked does `wake_all()`
+    /// enter the kernel (a futex wake on Linux, a condition variable elsewhere).
+    ///
+    /// A `Notifier` can be attached to forward wake requests to waiters that do not
+    /// block on this service, such as the runner's `Reactor` blocked in `epoll_wait`.
+    ///
+    /// On Linux the service can also be backed by an `eventfd` (`enable_event_fd()` or
+    /// `attach_event_fd()`). The descriptor can be polled together with sockets and
+    /// timers, inherited by a child process or passed over a Unix socket with
+    /// `send_file_descriptor()`; writes to it from anywhere advance the generation.
+    /// In this mode the descriptor is the only source of generation changes: `wake_all()`
+    /// just writes it, and the count is added when the descriptor is drained, so each
+    /// wake advances the generation once. `generation()` drains before loading. One
+    /// blocked waiter at a time polls the descriptor; the others wait on the futex and
+    /// are woken when the poller, or anyone else draining it, advances the generation.
+    ///
+    /// Besides the global generation, the service has `CONSOLIX_WAKE_CHANNEL_LIMIT`
+    /// targeted channels. `wake(channel)` wakes only the threads waiting on that channel,
+    /// so posting to one subsystem does not wake the main loop or other subsystems.
+    /// Channel waiters still wake on `wake_all()`, which remains a broadcast.
     class LoopWakeService {
     public:
         /// \brief Monotonic wake generation type.
         typedef std::uint64_t Generation;
 
+        /// \brief Identifier of a targeted wake channel, below `channel_limit()`.
+        typedef std::uint32_t Channel;
+
+        /// \class Notifier
+        /// \brief Receives every wake request after the generation changes.
+        class Notifier {
+        public:
+            /// \brief Virtual destructor for polymorphic usage.
+            virtual ~Notifier() = default;
+
+            /// \brief Called from `wake_all()` on the waking thread; must not block.
+            virtual void notify() = 0;
+        };
+
+        /// \brief Constructs a service that wakes waiters in this process only.
+        LoopWakeService() = default;
+
+        /// \brief Closes the wake `eventfd` if one is owned.
+        ~LoopWakeService() {
+#           if defined(__linux__)
+            const int fd = m_event_fd.load(std::memory_order_acquire);
+            if (fd >= 0) {
+                ::close(fd);
+                ::close(m_doorbell_fd.load(std::memory_order_relaxed));
+            }
+#           endif
+        }
+
+        LoopWakeService(const LoopWakeService&) = delete;
+        LoopWakeService& operator=(const LoopWakeService&) = delete;
+
+        /// \brief Creates a wake `eventfd` and switches the service to descriptor mode.
+        /// \return The pollable descriptor (owned by the service), or `-1` where `eventfd` is unavailable.
+        /// \throws std::runtime_error If the descriptor cannot be created.
+        int enable_event_fd() {
+#           if defined(__linux__)
+            const int existing = event_fd();
+            if (existing >= 0) {
+                return existing;
+            }
+            const int fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (fd < 0) {
+                throw std::runtime_error("LoopWakeService: eventfd failed");
+            }
+            if (!attach_event_fd(fd)) {
+                ::close(fd);
+                return event_fd();
+            }
+            return fd;
+#           else
+            return -1;
+#           endif
+        }
+
+        /// \brief Adopts an existing `eventfd`, for example one received from another process.
+        ///
+        /// The service takes ownership and closes the descriptor on destruction. Waiters
+        /// already blocked switch to the descriptor on their next loop.
+        /// \param fd Non-blocking `eventfd` descriptor.
+        /// \return `false` if the service already has a descriptor or the platform has no `eventfd`.
+        /// \throws std::runtime_error If the poller's private descriptor cannot be created.
+        bool attach_event_fd(int fd) {
+#           if defined(__linux__)
+            if (fd < 0 || event_fd() >= 0) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (event_fd() >= 0) {
+                return false;
+            }
+            const int doorbell = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (doorbell < 0) {
+                throw std::runtime_error("LoopWakeService: eventfd failed");
+            }
+            m_doorbell_fd.store(doorbell, std::memory_order_relaxed);
+            m_event_fd.store(fd, std::memory_order_release);
+            wake_sleepers();
+            return true;
+#           else
+            (void)fd;
+            return false;
+#           endif
+        }
+
+        /// \brief Returns the wake `eventfd`, or `-1` in in-process mode.
+        int event_fd() const {
+#           if defined(__linux__)
+            return m_event_fd.load(std::memory_order_acquire);
+#           else
+            return -1;
+#           endif
+        }
+
+        /// \brief Converts pending `eventfd` wake-ups into a generation change.
+        ///
+        /// Call this when an external poller (such as a `Reactor`) reports the
+        /// descriptor readable; waiters inside the service do it themselves.
+        /// \return `true` if wake-ups were pending.
+        bool absorb_event_fd() {
+            return drain_event_fd(false);
+        }
+
+        /// \brief Attaches a notifier, replacing any previous one.
+        /// \param notifier Notifier to call on wake requests, or `nullptr` to detach.
+        void set_notifier(std::shared_ptr<Notifier> notifier) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_has_notifier.store(notifier != nullptr, std::memory_order_release);
+            m_notifier = std::move(notifier);
+        }
+
         /// \brief Returns the current wake generation.
+        ///
+        /// In descriptor mode pending descriptor writes are absorbed first, which costs
+        /// one non-blocking `read`.
         /// \return Current generation value.
-        Generation generation() const {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            return m_generation;
+        Generation generation() {
+            drain_event_fd(false);
+            return m_generation.load(std::memory_order_acquire);
         }
 
         /// \brief Wakes all current and next-pass waiters.
+        ///
+        /// In descriptor mode this only writes the descriptor; the generation advances
+        /// when it is drained.
         void wake_all() {
-            {
-                std::lock_guard<std::mutex> lock(m_mutex);
-                ++m_generation;
+            if (!signal_event_fd()) {
+                m_generation.fetch_add(1, std::memory_order_seq_cst);
+                if (m_sleepers.load(std::memory_order_seq_cst) != 0) {
+                    wake_sleepers();
+                }
+            }
+            if (m_channel_sleepers.load(std::memory_order_seq_cst) != 0) {
+                wake_channel_sleepers();
+            }
+            if (m_has_notifier.load(std::memory_order_acquire)) {
+                notify_notifier();
             }
-            m_condition.notify_all();
+        }
+
+        /// \brief Returns the number of channels each service provides.
+        static std::size_t channel_limit() {
+            return CONSOLIX_WAKE_CHANNEL_LIMIT;
+        }
+
+        /// \brief Returns the channel named `name`, assigning the next free one on first use.
+        /// \param name Subsystem or topic name, for example `"network"`.
+        /// \return Channel identifier shared by every caller using the same name.
+        /// \throws std::length_error If all channels are already named.
+        Channel channel(const std::string& name) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_channel_names.find(name);
+            if (it != m_channel_names.end()) {
+                return it->second;
+            }
+            if (m_channel_names.size() >= channel_limit()) {
+                throw std::length_error("LoopWakeService: no free wake channel for " + name);
+            }
+            const Channel id = static_cast<Channel>(m_channel_names.size());
+            m_channel_names[name] = id;
+            return id;
+        }
+
+        /// \brief Returns the generation observed by waiters on a channel.
+        ///
+        /// The value changes on `wake(channel)` and on `wake_all()`.
+        /// \throws std::out_of_range If `channel` is not below `channel_limit()`.
+        Generation generation(Channel channel) {
+            const ChannelState& state = channel_state(channel);
+            drain_event_fd(false);
+            return channel_generation(state);
+        }
+
+        /// \brief Wakes only the waiters of one channel.
+        /// \throws std::out_of_range If `channel` is not below `channel_limit()`.
+        void wake(Channel channel) {
+            ChannelState& state = channel_state(channel);
+            state.generation.fetch_add(1, std::memory_order_seq_cst);
+            if (state.sleepers.load(std::memory_order_seq_cst) != 0) {
+                wake_channel(state);
+            }
+        }
+
+        /// \brief Waits until a channel is woken, `wake_all()` is called, or timeout expires.
+        /// \param channel Channel to wait on.
+        /// \param observed_generation Last value of `generation(channel)` seen by the caller.
+        /// \param timeout Maximum wait duration.
+        /// \return `true` if a change was observed.
+        bool wait_for_change(
+                Channel channel,
+                Generation& observed_generation,
+                std::chrono::nanoseconds timeout) {
+            return wait_until_change(channel, observed_generation, std::chrono::steady_clock::now() + timeout);
+        }
+
+        /// \brief Waits until a channel is woken, `wake_all()` is called, or the deadline passes.
+        /// \param channel Channel to wait on.
+        /// \param observed_generation Last value of `generation(channel)` seen by the caller.
+        /// \param deadline Time point at which the wait ends.
+        /// \return `true` if a change was observed.
+        bool wait_until_change(
+                Channel channel,
+                Generation& observed_generation,
+                std::chrono::steady_clock::time_point deadline) {
+            ChannelState& state = channel_state(channel);
+            if (observe_channel_change(state, observed_generation)) {
+                return true;
+            }
+            SleeperGuard sleeper(state.sleepers);
+            SleeperGuard channel_sleeper(m_channel_sleepers);
+            return sleep_until_channel_change(state, observed_generation, deadline);
         }
 
         /// \brief Waits until the wake generation changes or timeout expires.
@@ -45,34 +283,395 @@ namespace consolix {
         /// \return `true` if a wake generation change was observed.
         bool wait_for_change(
                 Generation& observed_generation,
-                std::chrono::milliseconds timeout) {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            if (m_generation != observed_generation) {
-                observed_generation = m_generation;
+                std::chrono::nanoseconds timeout) {
+            drain_event_fd(false);
+            if (observe_change(observed_generation)) {
+                return true;
+            }
+            if (timeout <= std::chrono::nanoseconds::zero()) {
+                return false;
+            }
+            return wait_until_change(observed_generation, std::chrono::steady_clock::now() + timeout);
+        }
+
+        /// \brief Waits until the wake generation changes or the deadline passes.
+        /// \param observed_generation Last generation observed by the caller.
+        /// \param deadline Time point at which the wait ends.
+        /// \return `true` if a wake generation change was observed.
+        bool wait_until_change(
+                Generation& observed_generation,
+                std::chrono::steady_clock::time_point deadline) {
+            drain_event_fd(false);
+            if (observe_change(observed_generation)) {
+                return true;
+            }
+            SleeperGuard sleeper(m_sleepers);
+            return sleep_until_change(observed_generation, deadline);
+        }
+
+        /// \brief Waits like `wait_until_change()`, but blocks only until `sleeper.spin_margin()`
+        /// before the deadline and spins for the rest, for sub-millisecond loop periods.
+        ///
+        /// `wake_all()` calls end the spin at once. In descriptor mode each spin check
+        /// drains the descriptor, so writes from other processes end it too.
+        /// \param observed_generation Last generation observed by the caller.
+        /// \param deadline Time point at which the wait ends.
+        /// \param sleeper Calibrated sleeper of the waiting thread.
+        /// \return `true` if a wake generation change was observed.
+        bool wait_until_change(
+                Generation& observed_generation,
+                std::chrono::steady_clock::time_point deadline,
+                HybridSleeper& sleeper) {
+            return sleeper.wait_until(
+                deadline,
+                [this, &observed_generation](std::chrono::steady_clock::time_point coarse_deadline) {
+                    return wait_until_change(observed_generation, coarse_deadline);
+                },
+                [this, &observed_generation]() {
+                    const Generation current = generation();
+                    if (current == observed_generation) {
+                        return false;
+                    }
+                    observed_generation = current;
+                    return true;
+                });
+        }
+
+    private:
+        /// \brief Registers a blocked waiter for the lifetime of a wait.
+        class SleeperGuard {
+        public:
+            explicit SleeperGuard(std::atomic<std::uint32_t>& sleepers) : m_sleepers(sleepers) {
+                m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+            }
+
+            ~SleeperGuard() {
+                m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic<std::uint32_t>& m_sleepers;
+        };
+
+        /// \brief Per-channel generation and sleepers.
+        ///
+        /// Each slot takes its own cache line, so producers waking different channels
+        /// do not write to a shared line.
+        struct alignas(64) ChannelState {
+            std::atomic<Generation>    generation{0};
+            std::atomic<std::uint32_t> sleepers{0};
+#           if defined(__linux__)
+            std::atomic<std::uint32_t> futex_word{0};
+#           else
+            std::condition_variable    condition;
+#           endif
+        };
+
+        std::atomic<Generation>    m_generation{0};
+        std::atomic<std::uint32_t> m_sleepers{0};
+        std::atomic<bool>          m_has_notifier{false};
+        mutable std::mutex         m_mutex;          ///< Guards the notifier, descriptor attachment and, off Linux, sleeping.
+        std::shared_ptr<Notifier>  m_notifier;
+        std::map<std::string, Channel> m_channel_names; ///< Guarded by `m_mutex`.
+        ChannelState               m_channels[CONSOLIX_WAKE_CHANNEL_LIMIT];
+        std::atomic<std::uint32_t> m_channel_sleepers{0}; ///< Sleepers across all channels.
+#       if defined(__linux__)
+        std::atomic<std::uint32_t> m_futex_word{0};  ///< Bumped before each futex wake.
+        std::atomic<int>           m_event_fd{-1};   ///< Wake `eventfd` in descriptor mode.
+        std::atomic<int>           m_doorbell_fd{-1}; ///< Wakes the poller when another thread drained `m_event_fd`.
+        std::atomic<bool>          m_fd_polled{false}; ///< Whether a sleeper is polling `m_event_fd`.
+#       else
+        std::condition_variable    m_condition;
+#       endif
+
+        /// \brief Compares the generation with the caller's and updates it on change.
+        bool observe_change(Generation& observed_generation) {
+            const Generation current = m_generation.load(std::memory_order_acquire);
+            if (current != observed_generation) {
+                observed_generation = current;
+                return true;
+            }
+            return false;
+        }
+
+        ChannelState& channel_state(Channel channel) {
+            if (channel >= channel_limit()) {
+                throw std::out_of_range("LoopWakeService: wake channel out of range");
+            }
+            return m_channels[channel];
+        }
+
+        const ChannelState& channel_state(Channel channel) const {
+            if (channel >= channel_limit()) {
+                throw std::out_of_range("LoopWakeService: wake channel out of range");
+            }
+            return m_channels[channel];
+        }
+
+        /// \brief Sums channel and global generations, so either kind of wake changes it.
+        Generation channel_generation(const ChannelState& state) const {
+            return state.generation.load(std::memory_order_seq_cst) +
+                   m_generation.load(std::memory_order_seq_cst);
+        }
+
+        /// \brief Drains the descriptor first, since `wake_all()` only writes it in descriptor mode.
+        bool observe_channel_change(const ChannelState& state, Generation& observed_generation) {
+            drain_event_fd(false);
+            const Generation current = channel_generation(state);
+            if (current != observed_generation) {
+                observed_generation = current;
                 return true;
             }
+            return false;
+        }
+
+        void wake_channel_sleepers() {
+            for (std::size_t index = 0; index < channel_limit(); ++index) {
+                if (m_channels[index].sleepers.load(std::memory_order_seq_cst) != 0) {
+                    wake_channel(m_channels[index]);
+                }
+            }
+        }
+
+        void notify_notifier() {
+            std::shared_ptr<Notifier> notifier;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                notifier = m_notifier;
+            }
+            if (notifier) {
+                notifier->notify();
+            }
+        }
+
+#       if defined(__linux__)
+        // The sleeper reads the futex word before re-checking the generation, and the
+        // waker bumps the word after publishing the generation and seeing a sleeper.
+        // With sequentially consistent operations either the sleeper sees the new
+        // generation or FUTEX_WAIT sees a changed word, so no wake-up is lost.
+        void wake_sleepers() {
+            m_futex_word.fetch_add(1, std::memory_order_seq_cst);
+            ::syscall(SYS_futex, futex_address(m_futex_word), FUTEX_WAKE_PRIVATE, 0x7fffffff, nullptr, nullptr, 0);
+        }
+
+        void wake_channel(ChannelState& state) {
+            state.futex_word.fetch_add(1, std::memory_order_seq_cst);
+            ::syscall(SYS_futex, futex_address(state.futex_word), FUTEX_WAKE_PRIVATE, 0x7fffffff, nullptr, nullptr, 0);
+        }
+
+        bool sleep_until_channel_change(
+                ChannelState& state,
+                Generation& observed_generation,
+                std::chrono::steady_clock::time_point deadline) {
+            typedef std::chrono::steady_clock Clock;
+            while (true) {
+                const std::uint32_t word = state.futex_word.load(std::memory_order_seq_cst);
+                if (observe_channel_change(state, observed_generation)) {
+                    return true;
+                }
+                if (deadline <= Clock::now()) {
+                    return false;
+                }
+                futex_wait_until(state.futex_word, word, deadline);
+            }
+        }
+
+        /// \brief Makes a sleeper the descriptor poller while one is needed and none exists.
+        ///
+        /// Releasing the role wakes the futex sleepers so that one of them takes it over.
+        class PollerGuard {
+        public:
+            explicit PollerGuard(LoopWakeService& service) : m_service(service) {
+            }
+
+            ~PollerGuard() {
+                if (m_polling) {
+                    m_service.m_fd_polled.store(false, std::memory_order_seq_cst);
+                    if (m_service.m_sleepers.load(std::memory_order_seq_cst) > 1) {
+                        m_service.wake_sleepers();
+                    }
+                }
+            }
+
+            PollerGuard(const PollerGuard&) = delete;
+            PollerGuard& operator=(const PollerGuard&) = delete;
+
+            /// \brief Returns whether the caller polls, claiming the role if it is free.
+            bool acquire() {
+                if (!m_polling) {
+                    m_polling = !m_service.m_fd_polled.exchange(true, std::memory_order_seq_cst);
+                }
+                return m_polling;
+            }
+
+        private:
+            LoopWakeService& m_service;
+            bool             m_polling{false};
+        };
 
-            if (timeout <= std::chrono::milliseconds(0)) {
+        // In descriptor mode only the poller consumes the descriptor, so wake-ups are not
+        // lost to a sibling's read. Other sleepers use the futex protocol above: every
+        // drain that advances the generation wakes them. A drain by a thread other than
+        // the poller rings the doorbell, which the poller clears before each check.
+        bool sleep_until_change(
+                Generation& observed_generation,
+                std::chrono::steady_clock::time_point deadline) {
+            typedef std::chrono::steady_clock Clock;
+            PollerGuard poller(*this);
+            while (true) {
+                const std::uint32_t word = m_futex_word.load(std::memory_order_seq_cst);
+                const int fd = m_event_fd.load(std::memory_order_acquire);
+                const bool polling = fd >= 0 && poller.acquire();
+                if (polling) {
+                    clear_doorbell();
+                    drain_event_fd(true);
+                }
+                if (observe_change(observed_generation)) {
+                    return true;
+                }
+                const Clock::duration remaining = deadline - Clock::now();
+                if (remaining <= Clock::duration::zero()) {
+                    return false;
+                }
+                if (polling) {
+                    timespec relative = to_timespec(remaining);
+                    pollfd descriptors[2] = {};
+                    descriptors[0].fd = fd;
+                    descriptors[0].events = POLLIN;
+                    descriptors[1].fd = m_doorbell_fd.load(std::memory_order_relaxed);
+                    descriptors[1].events = POLLIN;
+                    ::ppoll(descriptors, 2, &relative, nullptr);
+                } else {
+                    futex_wait_until(m_futex_word, word, deadline);
+                }
+            }
+        }
+
+        /// \brief Writes the wake descriptor in descriptor mode, where the poller waits on it.
+        bool signal_event_fd() {
+            const int fd = m_event_fd.load(std::memory_order_acquire);
+            if (fd < 0) {
                 return false;
             }
+            write_event_fd(fd);
+            return true;
+        }
+
+        /// \brief Converts pending descriptor wake-ups into a generation change.
+        /// \param polling Whether the caller is the sleeper polling the descriptor.
+        bool drain_event_fd(bool polling) {
+            const int fd = m_event_fd.load(std::memory_order_acquire);
+            if (fd < 0 || read_event_fd(fd) == 0) {
+                return false;
+            }
+            if (m_sleepers.load(std::memory_order_seq_cst) > (polling ? 1u : 0u)) {
+                wake_sleepers();
+            }
+            if (m_channel_sleepers.load(std::memory_order_seq_cst) != 0) {
+                wake_channel_sleepers();
+            }
+            if (!polling && m_fd_polled.load(std::memory_order_seq_cst)) {
+                write_event_fd(m_doorbell_fd.load(std::memory_order_relaxed));
+            }
+            return true;
+        }
+
+        /// \brief Reads the descriptor and adds its count to the generation.
+        /// \return The count read, or `0` if none was pending.
+        std::uint64_t read_event_fd(int fd) {
+            std::uint64_t count = 0;
+            if (::read(fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+                return 0;
+            }
+            m_generation.fetch_add(count, std::memory_order_seq_cst);
+            return count;
+        }
+
+        void clear_doorbell() {
+            std::uint64_t count = 0;
+            const ssize_t result = ::read(m_doorbell_fd.load(std::memory_order_relaxed), &count, sizeof(count));
+            (void)result;
+        }
+
+        /// \brief Blocks while `word` holds `expected`, until an absolute `CLOCK_MONOTONIC`
+        /// deadline, so spurious returns never stretch the total wait.
+        static void futex_wait_until(
+                std::atomic<std::uint32_t>& word,
+                std::uint32_t expected,
+                std::chrono::steady_clock::time_point deadline) {
+            const timespec absolute = monotonic_timespec(deadline);
+            ::syscall(SYS_futex, futex_address(word), FUTEX_WAIT_BITSET_PRIVATE, expected, &absolute,
+                      nullptr, FUTEX_BITSET_MATCH_ANY);
+        }
+
+        static timespec to_timespec(std::chrono::steady_clock::duration duration) {
+            const std::chrono::nanoseconds value = std::chrono::duration_cast<std::chrono::nanoseconds>(duration);
+            timespec result = {};
+            result.tv_sec = static_cast<time_t>(value.count() / 1000000000);
+            result.tv_nsec = static_cast<long>(value.count() % 1000000000);
+            return result;
+        }
 
-            const bool changed = m_condition.wait_for(
+        static void write_event_fd(int fd) {
+            const std::uint64_t one = 1;
+            const ssize_t result = ::write(fd, &one, sizeof(one));
+            (void)result;
+        }
+
+        static std::uint32_t* futex_address(std::atomic<std::uint32_t>& word) {
+            static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                          "futex word must be a plain 32-bit integer");
+            return reinterpret_cast<std::uint32_t*>(&word);
+        }
+#       else
+        bool signal_event_fd() {
+            return false;
+        }
+
+        bool drain_event_fd(bool) {
+            return false;
+        }
+
+        void wake_sleepers() {
+            // Taking the lock orders this wake after a sleeper's predicate check.
+            { std::lock_guard<std::mutex> lock(m_mutex); }
+            m_condition.notify_all();
+        }
+
+        void wake_channel(ChannelState& state) {
+            { std::lock_guard<std::mutex> lock(m_mutex); }
+            state.condition.notify_all();
+        }
+
+        bool sleep_until_channel_change(
+                ChannelState& state,
+                Generation& observed_generation,
+                std::chrono::steady_clock::time_point deadline) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return state.condition.wait_until(
                 lock,
-                timeout,
-                [this, observed_generation]() {
-                    return m_generation != observed_generation;
+                deadline,
+                [this, &state, &observed_generation]() {
+                    return observe_channel_change(state, observed_generation);
                 });
+        }
 
+        bool sleep_until_change(
+                Generation& observed_generation,
+                std::chrono::steady_clock::time_point deadline) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            const bool changed = m_condition.wait_until(
+                lock,
+                deadline,
+                [this, &observed_generation]() {
+                    return m_generation.load(std::memory_order_seq_cst) != observed_generation;
+                });
             if (changed) {
-                observed_generation = m_generation;
+                observed_generation = m_generation.load(std::memory_order_acquire);
             }
             return changed;
         }
-
-    private:
-        mutable std::mutex      m_mutex;
-        std::condition_variable m_condition;
-        Generation              m_generation{0};
+#       endif
     }; // LoopWakeService
 
 } // namespace consolix
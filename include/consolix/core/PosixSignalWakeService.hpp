@@ -8,6 +8,7 @@
 
 #include "LoopWakeService.hpp"
 #include "ServiceLocator.hpp"
+#include "ThreadPlacement.hpp"
 
 #include <atomic>
 #include <chrono>
@@ -30,7 +31,9 @@ namespace consolix {
     ///
     /// The regular POSIX signal handler remains async-signal-safe: it records the
     /// signal in the runner and asks this service to write one byte to a self-pipe.
-    /// A watcher thread then wakes `LoopWakeService` from ordinary C++ code.
+    /// A watcher thread then wakes `LoopWakeService` from ordinary C++ code. The
+    /// watcher is named `cx-signal` and placed by the current locator's
+    /// `ThreadPlacement`, if one is registered.
     ///
     /// This service is opt-in and POSIX-only. On Windows it compiles as a no-op.
     class PosixSignalWakeService {
@@ -64,6 +67,8 @@ namespace consolix {
 #if defined(_WIN32) || defined(_WIN64)
             return false;
 #else
+            std::shared_ptr<ThreadPlacement> placement =
+                ServiceLocator::current().find_service<ThreadPlacement>();
             std::lock_guard<std::mutex> lock(m_mutex);
             if (m_running) {
                 return true;
@@ -79,7 +84,10 @@ namespace consolix {
 
                 m_stop_requested.store(false);
                 signal_wake_fd() = static_cast<std::sig_atomic_t>(m_pipe_fds[1]);
-                m_watcher = std::thread(&PosixSignalWakeService::watch_loop, this);
+                m_watcher = std::thread([this, placement]() {
+                    const PlacedThread placed = place_current_thread(placement, "cx-signal");
+                    watch_loop();
+                });
                 m_running = true;
             } catch (...) {
                 signal_wake_fd() = static_cast<std::sig_atomic_t>(-1);
@@ -158,10 +166,11 @@ namespace consolix {
         bool                        m_running{false};
 
         void setup_loop_wake_service() {
-            auto service = ServiceLocator::get_instance().find_service<LoopWakeService>();
+            ServiceLocator& locator = ServiceLocator::current();
+            auto service = locator.find_service<LoopWakeService>();
             if (!service) {
-                ServiceLocator::get_instance().register_service<LoopWakeService>();
-                service = ServiceLocator::get_instance().find_service<LoopWakeService>();
+                locator.register_service<LoopWakeService>();
+                service = locator.find_service<LoopWakeService>();
             }
             m_loop_wake_service = service;
         }
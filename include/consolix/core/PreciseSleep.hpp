@@ -0,0 +1,168 @@
+#pragma once
+#ifndef _CONSOLIX_PRECISE_SLEEP_HPP_INCLUDED
+#define _CONSOLIX_PRECISE_SLEEP_HPP_INCLUDED
+
+/// \file PreciseSleep.hpp
+/// \brief Absolute-deadline sleeps and a calibrated sleep-then-spin waiter.
+/// \ingroup Core
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "../config_macros.hpp"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <ctime>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace consolix {
+
+    /// \brief Tells the CPU that the caller is spinning, which saves power and
+    /// frees pipeline resources for a sibling hyper-thread.
+    inline void cpu_relax() {
+#       if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#       elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield" ::: "memory");
+#       elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#       endif
+    }
+
+#   if defined(__linux__)
+    /// \brief Converts a `steady_clock` deadline to an absolute `CLOCK_MONOTONIC` time.
+    ///
+    /// libstdc++ and libc++ implement `steady_clock` with `CLOCK_MONOTONIC` on Linux,
+    /// so the epoch offset is used directly.
+    inline timespec monotonic_timespec(std::chrono::steady_clock::time_point deadline) {
+        const std::chrono::nanoseconds value =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch());
+        timespec result = {};
+        if (value.count() > 0) {
+            result.tv_sec = static_cast<time_t>(value.count() / 1000000000);
+            result.tv_nsec = static_cast<long>(value.count() % 1000000000);
+        }
+        return result;
+    }
+#   endif
+
+    /// \brief Sleeps until an absolute deadline.
+    ///
+    /// On Linux this is `clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME)`, so signal
+    /// interruptions and late scheduling never push the wake-up past `deadline`.
+    inline void sleep_until_precise(std::chrono::steady_clock::time_point deadline) {
+#       if defined(__linux__)
+        const timespec target = monotonic_timespec(deadline);
+        while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR) {
+        }
+#       else
+        std::this_thread::sleep_until(deadline);
+#       endif
+    }
+
+    /// \brief Sleeps for a duration with nanosecond resolution.
+    inline void sleep_for_precise(std::chrono::nanoseconds duration) {
+        if (duration > std::chrono::nanoseconds::zero()) {
+            sleep_until_precise(std::chrono::steady_clock::now() + duration);
+        }
+    }
+
+    /// \class HybridSleeper
+    /// \brief Sleeps until shortly before a deadline and spins for the rest.
+    ///
+    /// Kernel sleeps end late by the timer slack plus the scheduling latency, typically
+    /// 50-100 us on Linux, which is the whole budget of a 50-200 us loop period. The
+    /// sleeper ends its kernel sleep `spin_margin()` early and spins on the clock for the
+    /// remainder. The margin tracks how late past sleeps actually woke up, as a mean
+    /// plus four mean deviations (the estimator TCP uses for retransmission timeouts),
+    /// capped at `max_spin()`, so a loop spins only as long as the system requires.
+    ///
+    /// Keep one sleeper per waiting thread; it is not thread-safe.
+    class HybridSleeper {
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        /// \brief Creates a sleeper.
+        /// \param max_spin Longest spin tail; zero disables spinning.
+        explicit HybridSleeper(std::chrono::nanoseconds max_spin =
+                                   std::chrono::microseconds(CONSOLIX_HYBRID_SLEEP_MAX_SPIN_US)) :
+                m_max_spin(max_spin > std::chrono::nanoseconds::zero() ? max_spin.count() : 0),
+                m_mean(m_max_spin / 2) {
+        }
+
+        /// \brief Sleeps until `deadline`, spinning through the last `spin_margin()`.
+        void sleep_until(Clock::time_point deadline) {
+            wait_until(
+                deadline,
+                [](Clock::time_point coarse_deadline) {
+                    sleep_until_precise(coarse_deadline);
+                    return false;
+                },
+                []() {
+                    return false;
+                });
+        }
+
+        /// \brief Sleeps for `duration`, spinning through the last `spin_margin()`.
+        void sleep_for(std::chrono::nanoseconds duration) {
+            sleep_until(Clock::now() + duration);
+        }
+
+        /// \brief Waits until `deadline` or until a wait or poll reports a wake-up.
+        /// \param deadline Time point at which the wait ends.
+        /// \param coarse_wait Blocking wait `bool(Clock::time_point)` returning `true` on a wake-up.
+        /// \param poll Non-blocking check `bool()` run while spinning, `true` on a wake-up.
+        /// \return `true` if woken before the deadline.
+        template <typename CoarseWait, typename Poll>
+        bool wait_until(Clock::time_point deadline, CoarseWait coarse_wait, Poll poll) {
+            const Clock::time_point coarse_deadline = deadline - std::chrono::nanoseconds(spin_margin());
+            if (Clock::now() < coarse_deadline) {
+                if (coarse_wait(coarse_deadline)) {
+                    return true;
+                }
+                const Clock::time_point woke = Clock::now();
+                if (woke >= coarse_deadline) {
+                    record_lateness(std::chrono::duration_cast<std::chrono::nanoseconds>(woke - coarse_deadline).count());
+                }
+            }
+            while (Clock::now() < deadline) {
+                if (poll()) {
+                    return true;
+                }
+                cpu_relax();
+            }
+            return false;
+        }
+
+        /// \brief Returns how long before a deadline the kernel sleep currently ends.
+        std::chrono::nanoseconds spin_margin() const {
+            const std::int64_t margin = m_mean + 4 * m_deviation;
+            return std::chrono::nanoseconds(margin < m_max_spin ? margin : m_max_spin);
+        }
+
+        /// \brief Returns the longest spin tail.
+        std::chrono::nanoseconds max_spin() const {
+            return std::chrono::nanoseconds(m_max_spin);
+        }
+
+    private:
+        std::int64_t m_max_spin;
+        std::int64_t m_mean;         ///< Smoothed wake-up lateness in nanoseconds.
+        std::int64_t m_deviation{0}; ///< Smoothed mean deviation of the lateness.
+
+        void record_lateness(std::int64_t lateness) {
+            const std::int64_t error = lateness - m_mean;
+            m_mean += error / 8;
+            m_deviation += ((error < 0 ? -error : error) - m_deviation) / 4;
+        }
+    }; // HybridSleeper
+
+} // namespace consolix
+
+#endif // _CONSOLIX_PRECISE_SLEEP_HPP_INCLUDED
@@ -0,0 +1,434 @@
+#pragma once
+#ifndef _CONSOLIX_REACTOR_HPP_INCLUDED
+#define _CONSOLIX_REACTOR_HPP_INCLUDED
+
+/// \file Reactor.hpp
+/// \brief epoll-based event demultiplexer for the runner's reactor mode (Linux only).
+/// \ingroup Core
+
+#include "LoopWakeService.hpp"
+
+#if defined(__linux__)
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace consolix {
+
+    /// \class Reactor
+    /// \brief Waits on file descriptors, timers and wake requests with one `epoll_wait`.
+    ///
+    /// Components register descriptors with `add_fd()` and periodic or one-shot timers
+    /// (backed by `timerfd`) with `add_timer()`. `run_once()` blocks until something is
+    /// ready and calls only the handlers of ready sources. `wake()` (and, once attached,
+    /// every `LoopWakeService::wake_all()`) interrupts the wait through an `eventfd`.
+    ///
+    /// With `ConsoleApplicationRunner::enable_reactor()` the runner owns one reactor,
+    /// registers it in the manager's `ServiceLocator` and blocks in it between passes.
+    /// Components look it up in `initialize()`:
+    ///
+    /// ```cpp
+    /// auto& reactor = consolix::get_service<consolix::Reactor>();
+    /// reactor.add_fd(m_socket, EPOLLIN, [this](std::uint32_t) { read_socket(); });
+    /// m_timer = reactor.add_timer(std::chrono::milliseconds(250), [this](std::uint64_t) { flush(); });
+    /// ```
+    ///
+    /// Registration methods and `wake()` are thread-safe. Handlers run on the thread
+    /// that calls `run_once()` and may add or remove registrations.
+    class Reactor : public LoopWakeService::Notifier {
+    public:
+        /// \brief Handler for descriptor readiness; receives the `EPOLL*` event mask.
+        typedef std::function<void(std::uint32_t)> Handler;
+        /// \brief Handler for timer expiry; receives the number of expirations since the last call.
+        typedef std::function<void(std::uint64_t)> TimerHandler;
+
+        /// \brief Creates the epoll instance and its wake `eventfd`.
+        /// \throws std::runtime_error If a descriptor cannot be created.
+        Reactor() {
+            m_epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+            if (m_epoll_fd < 0) {
+                throw_errno("epoll_create1");
+            }
+            m_wake_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (m_wake_fd < 0) {
+                const int error = errno;
+                ::close(m_epoll_fd);
+                errno = error;
+                throw_errno("eventfd");
+            }
+            epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.u64 = 0;
+            if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wake_fd, &event) != 0) {
+                const int error = errno;
+                ::close(m_wake_fd);
+                ::close(m_epoll_fd);
+                errno = error;
+                throw_errno("epoll_ctl");
+            }
+        }
+
+        /// \brief Closes owned timer descriptors, the wake `eventfd` and the epoll instance.
+        ~Reactor() override {
+            unbind_signal_wakeups();
+            for (const auto& item : m_entries) {
+                if (item.second->timer) {
+                    ::close(item.second->fd);
+                }
+            }
+            if (m_deadline_fd >= 0) {
+                ::close(m_deadline_fd);
+            }
+            ::close(m_wake_fd);
+            ::close(m_epoll_fd);
+        }
+
+        Reactor(const Reactor&) = delete;
+        Reactor& operator=(const Reactor&) = delete;
+
+        /// \brief Registers a descriptor; the reactor does not take ownership of it.
+        /// \param fd Descriptor to watch.
+        /// \param events `EPOLLIN`, `EPOLLOUT` and other `epoll_event` flags.
+        /// \param handler Called with the ready event mask.
+        /// \throws std::runtime_error If `epoll_ctl` fails, for example when `fd` is already registered.
+        void add_fd(int fd, std::uint32_t events, Handler handler) {
+            std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+            entry->fd = fd;
+            entry->handler = std::move(handler);
+            insert(entry, events);
+        }
+
+        /// \brief Changes the events watched for a registered descriptor.
+        /// \throws std::runtime_error If `fd` is not registered or `epoll_ctl` fails.
+        void modify_fd(int fd, std::uint32_t events) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_fd_tokens.find(fd);
+            if (it == m_fd_tokens.end()) {
+                throw std::runtime_error("Reactor::modify_fd: descriptor is not registered");
+            }
+            epoll_event event = {};
+            event.events = events;
+            event.data.u64 = it->second;
+            if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, fd, &event) != 0) {
+                throw_errno("epoll_ctl");
+            }
+        }
+
+        /// \brief Unregisters a descriptor; unknown descriptors are ignored.
+        void remove_fd(int fd) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            erase_locked(fd);
+        }
+
+        /// \brief Starts a periodic timer.
+        /// \param interval Period; the first expiry is one period from now.
+        /// \param handler Called with the number of expirations.
+        /// \return Timer identifier for `cancel_timer()`.
+        /// \throws std::runtime_error If the timer cannot be created.
+        int add_timer(std::chrono::nanoseconds interval, TimerHandler handler) {
+            return add_timer(interval, interval, std::move(handler));
+        }
+
+        /// \brief Starts a timer with a separate first expiry.
+        /// \param first Time until the first expiry; must be positive.
+        /// \param interval Period after the first expiry; zero makes a one-shot timer.
+        /// \param handler Called with the number of expirations.
+        /// \return Timer identifier for `cancel_timer()`.
+        /// \throws std::runtime_error If the timer cannot be created.
+        int add_timer(std::chrono::nanoseconds first, std::chrono::nanoseconds interval, TimerHandler handler) {
+            const int fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            if (fd < 0) {
+                throw_errno("timerfd_create");
+            }
+            itimerspec spec = {};
+            spec.it_value = to_timespec(first > std::chrono::nanoseconds(0) ? first : std::chrono::nanoseconds(1));
+            spec.it_interval = to_timespec(interval);
+            if (::timerfd_settime(fd, 0, &spec, nullptr) != 0) {
+                const int error = errno;
+                ::close(fd);
+                errno = error;
+                throw_errno("timerfd_settime");
+            }
+
+            std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+            entry->fd = fd;
+            entry->timer = true;
+            entry->timer_handler = std::move(handler);
+            try {
+                insert(entry, EPOLLIN);
+            } catch (...) {
+                ::close(fd);
+                throw;
+            }
+            return fd;
+        }
+
+        /// \brief Stops and releases a timer; unknown identifiers are ignored.
+        void cancel_timer(int timer) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            erase_locked(timer);
+        }
+
+        /// \brief Interrupts a current or the next `run_once()`; safe from any thread.
+        void wake() {
+            write_wake_token(m_wake_fd);
+        }
+
+        /// \brief Forwards `LoopWakeService` wake requests to `wake()`.
+        void notify() override {
+            wake();
+        }
+
+        /// \brief Returns the number of registered descriptors and timers.
+        std::size_t registration_count() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_entries.size();
+        }
+
+        /// \brief Waits for ready sources and dispatches their handlers.
+        ///
+        /// Whole-millisecond timeouts go to `epoll_wait` directly; others wait on an
+        /// internal `timerfd` armed with an absolute deadline, so sub-millisecond
+        /// timeouts are neither rounded nor stretched.
+        /// \param timeout Maximum wait; negative waits without limit, zero only polls.
+        /// \return Number of handlers called; `0` after a timeout or a plain wake-up.
+        /// \throws std::runtime_error If a system call fails; rethrows handler exceptions.
+        std::size_t run_once(std::chrono::nanoseconds timeout) {
+            if (timeout < std::chrono::nanoseconds::zero()) {
+                return wait_and_dispatch(-1);
+            }
+            if (timeout.count() % 1000000 != 0) {
+                return run_until(std::chrono::steady_clock::now() + timeout);
+            }
+            const std::chrono::milliseconds::rep timeout_ms =
+                std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count();
+            return wait_and_dispatch(static_cast<int>(std::min<std::chrono::milliseconds::rep>(timeout_ms, 0x7fffffff)));
+        }
+
+        /// \brief Waits until an absolute deadline for ready sources and dispatches their handlers.
+        /// \param deadline End of the wait, with nanosecond resolution.
+        /// \return Number of handlers called; `0` after the deadline or a plain wake-up.
+        /// \throws std::runtime_error If a system call fails; rethrows handler exceptions.
+        std::size_t run_until(std::chrono::steady_clock::time_point deadline) {
+            if (deadline <= std::chrono::steady_clock::now()) {
+                return wait_and_dispatch(0);
+            }
+            arm_deadline(monotonic_timespec(deadline));
+            return wait_and_dispatch(-1);
+        }
+
+        /// \brief Makes POSIX signal handlers installed by the runner wake this reactor.
+        /// \return `true` if bound, `false` if another reactor already receives signal wake-ups.
+        bool bind_signal_wakeups() {
+            std::lock_guard<std::mutex> lock(signal_mutex());
+            if (signal_wake_fd() >= 0 && signal_owner() != this) {
+                return false;
+            }
+            signal_owner() = this;
+            signal_wake_fd() = static_cast<std::sig_atomic_t>(m_wake_fd);
+            return true;
+        }
+
+        /// \brief Stops signal wake-ups bound by `bind_signal_wakeups()`.
+        void unbind_signal_wakeups() {
+            std::lock_guard<std::mutex> lock(signal_mutex());
+            if (signal_owner() == this) {
+                signal_wake_fd() = static_cast<std::sig_atomic_t>(-1);
+                signal_owner() = nullptr;
+            }
+        }
+
+        /// \brief Async-signal-safe hook called by the runner signal handler.
+        static void notify_signal_handler() {
+            write_wake_token(static_cast<int>(signal_wake_fd()));
+        }
+
+    private:
+        struct Entry {
+            int          fd{-1};
+            bool         timer{false}; ///< Timer descriptors are owned by the reactor.
+            Handler      handler;
+            TimerHandler timer_handler;
+        };
+
+        int m_epoll_fd{-1};
+        int m_wake_fd{-1};
+        int m_deadline_fd{-1}; ///< Created on the first sub-millisecond wait; loop thread only.
+        mutable std::mutex m_mutex;
+        std::uint64_t m_next_token{1};
+        std::unordered_map<std::uint64_t, std::shared_ptr<Entry>> m_entries;
+        std::unordered_map<int, std::uint64_t> m_fd_tokens;
+
+        /// \brief Runs one `epoll_wait` with a millisecond timeout and dispatches the ready handlers.
+        std::size_t wait_and_dispatch(int timeout_ms) {
+            std::array<epoll_event, 64> events;
+            int ready = ::epoll_wait(m_epoll_fd, events.data(), static_cast<int>(events.size()), timeout_ms);
+            if (ready < 0) {
+                if (errno == EINTR) {
+                    return 0;
+                }
+                throw_errno("epoll_wait");
+            }
+
+            std::size_t dispatched = 0;
+            for (int i = 0; i < ready; ++i) {
+                const std::uint64_t token = events[i].data.u64;
+                if (token == 0) {
+                    drain(m_wake_fd);
+                    continue;
+                }
+                if (token == deadline_token()) {
+                    drain(m_deadline_fd);
+                    continue;
+                }
+
+                std::shared_ptr<Entry> entry;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    auto it = m_entries.find(token);
+                    if (it == m_entries.end()) {
+                        continue; // Removed by an earlier handler of this batch.
+                    }
+                    entry = it->second;
+                }
+
+                if (entry->timer) {
+                    const std::uint64_t expirations = drain(entry->fd);
+                    if (expirations == 0) {
+                        continue;
+                    }
+                    entry->timer_handler(expirations);
+                } else {
+                    entry->handler(events[i].events);
+                }
+                ++dispatched;
+            }
+            return dispatched;
+        }
+
+        /// \brief Arms the internal deadline `timerfd` for an absolute `CLOCK_MONOTONIC` time.
+        void arm_deadline(const timespec& deadline) {
+            if (m_deadline_fd < 0) {
+                m_deadline_fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+                if (m_deadline_fd < 0) {
+                    throw_errno("timerfd_create");
+                }
+                epoll_event event = {};
+                event.events = EPOLLIN;
+                event.data.u64 = deadline_token();
+                if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_deadline_fd, &event) != 0) {
+                    const int error = errno;
+                    ::close(m_deadline_fd);
+                    m_deadline_fd = -1;
+                    errno = error;
+                    throw_errno("epoll_ctl");
+                }
+            }
+            itimerspec spec = {};
+            spec.it_value = deadline;
+            if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) {
+                spec.it_value.tv_nsec = 1; // A zero value would disarm the timer.
+            }
+            if (::timerfd_settime(m_deadline_fd, TFD_TIMER_ABSTIME, &spec, nullptr) != 0) {
+                throw_errno("timerfd_settime");
+            }
+        }
+
+        /// \brief epoll token of the deadline timer; registration tokens count up from 1.
+        static std::uint64_t deadline_token() {
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+
+        void insert(const std::shared_ptr<Entry>& entry, std::uint32_t events) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // Tokens are never reused, so stale events of a removed descriptor cannot
+            // reach a new registration that got the same descriptor number.
+            const std::uint64_t token = m_next_token++;
+            epoll_event event = {};
+            event.events = events;
+            event.data.u64 = token;
+            if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, entry->fd, &event) != 0) {
+                throw_errno("epoll_ctl");
+            }
+            m_entries[token] = entry;
+            m_fd_tokens[entry->fd] = token;
+        }
+
+        void erase_locked(int fd) {
+            auto it = m_fd_tokens.find(fd);
+            if (it == m_fd_tokens.end()) {
+                return;
+            }
+            ::epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+            auto entry = m_entries.find(it->second);
+            if (entry != m_entries.end()) {
+                if (entry->second->timer) {
+                    ::close(fd);
+                }
+                m_entries.erase(entry);
+            }
+            m_fd_tokens.erase(it);
+        }
+
+        static std::uint64_t drain(int fd) {
+            std::uint64_t value = 0;
+            const ssize_t bytes = ::read(fd, &value, sizeof(value));
+            return bytes == static_cast<ssize_t>(sizeof(value)) ? value : 0;
+        }
+
+        static void write_wake_token(int fd) {
+            if (fd < 0) {
+                return;
+            }
+            const std::uint64_t one = 1;
+            const ssize_t result = ::write(fd, &one, sizeof(one));
+            (void)result;
+        }
+
+        static timespec to_timespec(std::chrono::nanoseconds duration) {
+            timespec value = {};
+            value.tv_sec = static_cast<time_t>(duration.count() / 1000000000);
+            value.tv_nsec = static_cast<long>(duration.count() % 1000000000);
+            return value;
+        }
+
+        static void throw_errno(const char* call) {
+            throw std::runtime_error(std::string("Reactor ") + call + " failed, errno " + std::to_string(errno));
+        }
+
+        static volatile std::sig_atomic_t& signal_wake_fd() {
+            static volatile std::sig_atomic_t fd = -1;
+            return fd;
+        }
+
+        static const Reactor*& signal_owner() {
+            static const Reactor* owner = nullptr;
+            return owner;
+        }
+
+        static std::mutex& signal_mutex() {
+            static std::mutex mutex;
+            return mutex;
+        }
+    }; // Reactor
+
+} // namespace consolix
+
+#endif // defined(__linux__)
+
+#endif // _CONSOLIX_REACTOR_HPP_INCLUDED
@@ -0,0 +1,391 @@
+#pragma once
+#ifndef _CONSOLIX_REALTIME_POLICY_HPP_INCLUDED
+#define _CONSOLIX_REALTIME_POLICY_HPP_INCLUDED
+
+/// \file RealtimePolicy.hpp
+/// \brief Real-time scheduling and memory-locking setup for the loop thread, and its report.
+/// \ingroup Core
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#include "../config_macros.hpp"
+
+#if defined(__linux__)
+#include <alloca.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <cstdlib>
+#endif
+
+namespace consolix {
+
+    /// \brief Scheduling class requested for the loop thread.
+    enum class RealtimeScheduler {
+        Unchanged,  ///< Keeps the thread's current policy.
+        Fifo,       ///< `SCHED_FIFO`: runs until it blocks or yields.
+        RoundRobin  ///< `SCHED_RR`: `SCHED_FIFO` with a time slice among equal priorities.
+    };
+
+    /// \class RealtimePolicy
+    /// \brief Selects the real-time settings `ConsoleApplicationRunner` applies before
+    /// components are initialized.
+    ///
+    /// A default policy requests nothing. Each setting is opt-in and best effort: a
+    /// setting the process is not allowed to apply is recorded as failed in the
+    /// `RealtimeReport` and the run continues without it.
+    ///
+    /// The scheduling class applies to the loop thread and is restored when the run
+    /// ends. Memory locking, the heap arena settings and the transparent huge page
+    /// setting apply to the whole process and stay in effect.
+    ///
+    /// ```cpp
+    /// consolix::ConsoleApplicationRunner runner(manager);
+    /// runner.set_realtime_policy(consolix::RealtimePolicy::locked());
+    /// ```
+    class RealtimePolicy {
+    public:
+        /// \brief Creates a policy that requests nothing.
+        RealtimePolicy() = default;
+
+        /// \brief Returns a policy that requests nothing.
+        static RealtimePolicy disabled() {
+            return RealtimePolicy();
+        }
+
+        /// \brief Creates the usual low-latency setup: a real-time class, locked memory,
+        /// prefaulted stack and heap, and no transparent huge pages.
+        /// \param scheduler Scheduling class for the loop thread.
+        /// \param priority Real-time priority, clamped to the range of `scheduler`.
+        static RealtimePolicy locked(
+                RealtimeScheduler scheduler = RealtimeScheduler::Fifo,
+                int priority = CONSOLIX_REALTIME_PRIORITY) {
+            RealtimePolicy policy;
+            policy.set_scheduler(scheduler, priority)
+                  .set_memory_lock(true)
+                  .set_stack_prefault(static_cast<std::size_t>(CONSOLIX_REALTIME_STACK_PREFAULT_KB) * 1024)
+                  .set_heap_prefault(static_cast<std::size_t>(CONSOLIX_REALTIME_HEAP_PREFAULT_KB) * 1024)
+                  .set_thp_disabled(true);
+            return policy;
+        }
+
+        /// \brief Requests a scheduling class for the loop thread.
+        ///
+        /// Without `CAP_SYS_NICE` the class is still applied when `RLIMIT_RTPRIO`
+        /// allows a lower priority; the report gives the priority actually used.
+        /// \param scheduler Scheduling class; `Unchanged` drops the request.
+        /// \param priority Real-time priority, clamped to the range of `scheduler`.
+        RealtimePolicy& set_scheduler(RealtimeScheduler scheduler, int priority) {
+            m_scheduler = scheduler;
+            m_priority = priority;
+            return *this;
+        }
+
+        /// \brief Requests `mlockall(MCL_CURRENT | MCL_FUTURE)`, so mapped pages are
+        /// never paged out and later allocations are faulted in when mapped.
+        RealtimePolicy& set_memory_lock(bool enabled) {
+            m_memory_lock = enabled;
+            return *this;
+        }
+
+        /// \brief Requests that the loop thread's stack be touched to this depth.
+        ///
+        /// The request fails without touching anything when the thread has less free
+        /// stack than `bytes` plus a safety margin.
+        RealtimePolicy& set_stack_prefault(std::size_t bytes) {
+            m_stack_prefault = bytes;
+            return *this;
+        }
+
+        /// \brief Requests that this many bytes of heap be faulted in and kept by malloc.
+        ///
+        /// With glibc this also disables heap trimming and `mmap`-backed allocations for
+        /// the process, so freed memory is reused instead of returned to the kernel.
+        /// With memory locking the prefault counts against `RLIMIT_MEMLOCK` and fails
+        /// with `ENOMEM` when the limit is too small.
+        RealtimePolicy& set_heap_prefault(std::size_t bytes) {
+            m_heap_prefault = bytes;
+            return *this;
+        }
+
+        /// \brief Requests `prctl(PR_SET_THP_DISABLE)`, which stops transparent huge page
+        /// collapse and fault-time compaction stalls for the process and its children.
+        RealtimePolicy& set_thp_disabled(bool disabled) {
+            m_thp_disabled = disabled;
+            return *this;
+        }
+
+        /// \brief Returns the requested scheduling class.
+        RealtimeScheduler scheduler() const {
+            return m_scheduler;
+        }
+
+        /// \brief Returns the requested real-time priority.
+        int priority() const {
+            return m_priority;
+        }
+
+        /// \brief Returns whether memory locking is requested.
+        bool memory_lock() const {
+            return m_memory_lock;
+        }
+
+        /// \brief Returns the requested stack prefault depth in bytes.
+        std::size_t stack_prefault() const {
+            return m_stack_prefault;
+        }
+
+        /// \brief Returns the requested heap prefault size in bytes.
+        std::size_t heap_prefault() const {
+            return m_heap_prefault;
+        }
+
+        /// \brief Returns whether transparent huge pages are to be disabled.
+        bool thp_disabled() const {
+            return m_thp_disabled;
+        }
+
+        /// \brief Checks whether the policy requests anything.
+        bool enabled() const {
+            return m_scheduler != RealtimeScheduler::Unchanged || m_memory_lock ||
+                   m_stack_prefault != 0 || m_heap_prefault != 0 || m_thp_disabled;
+        }
+
+    private:
+        RealtimeScheduler m_scheduler{RealtimeScheduler::Unchanged};
+        int               m_priority{0};
+        bool              m_memory_lock{false};
+        std::size_t       m_stack_prefault{0};
+        std::size_t       m_heap_prefault{0};
+        bool              m_thp_disabled{false};
+    }; // RealtimePolicy
+
+    /// \struct RealtimeSetting
+    /// \brief Outcome of one real-time setting.
+    struct RealtimeSetting {
+        bool requested{false}; ///< The policy asked for the setting.
+        bool applied{false};   ///< The setting took effect.
+        int  error{0};         ///< `errno` value when requested but not applied.
+
+        /// \brief Checks whether the setting was requested and did not take effect.
+        bool failed() const {
+            return requested && !applied;
+        }
+    };
+
+    /// \struct RealtimeReport
+    /// \brief Which settings of a `RealtimePolicy` took effect.
+    struct RealtimeReport {
+        RealtimeSetting scheduler;      ///< Scheduling class of the loop thread.
+        int             priority{0};    ///< Priority in effect when `scheduler.applied`.
+        RealtimeSetting memory_lock;    ///< `mlockall()`.
+        RealtimeSetting stack_prefault; ///< Stack touched to the requested depth.
+        std::size_t     stack_bytes{0}; ///< Bytes of stack touched.
+        RealtimeSetting heap_prefault;  ///< Heap faulted in and retained.
+        std::size_t     heap_bytes{0};  ///< Bytes of heap faulted in.
+        RealtimeSetting thp_disabled;   ///< Transparent huge pages disabled.
+
+        /// \brief Checks whether every requested setting took effect.
+        bool complete() const {
+            return !scheduler.failed() && !memory_lock.failed() && !stack_prefault.failed() &&
+                   !heap_prefault.failed() && !thp_disabled.failed();
+        }
+    };
+
+    /// \class ScopedRealtime
+    /// \brief Applies a `RealtimePolicy` to the calling thread and the process, and
+    /// restores the thread's scheduling class on scope exit.
+    ///
+    /// Settings are applied in an order that keeps them from undoing each other:
+    /// huge pages are disabled before memory is locked or touched, and the real-time
+    /// class is set last so prefaulting does not run at real-time priority.
+    ///
+    /// Supported on Linux. Elsewhere every requested setting fails with `ENOSYS`.
+    class ScopedRealtime {
+    public:
+        /// \brief Applies `policy`; failures are recorded in `report()`.
+        explicit ScopedRealtime(const RealtimePolicy& policy) {
+            m_report.scheduler.requested = policy.scheduler() != RealtimeScheduler::Unchanged;
+            m_report.memory_lock.requested = policy.memory_lock();
+            m_report.stack_prefault.requested = policy.stack_prefault() != 0;
+            m_report.heap_prefault.requested = policy.heap_prefault() != 0;
+            m_report.thp_disabled.requested = policy.thp_disabled();
+
+#           if defined(__linux__)
+            if (m_report.thp_disabled.requested) {
+                disable_thp();
+            }
+            if (m_report.memory_lock.requested) {
+                apply(m_report.memory_lock, ::mlockall(MCL_CURRENT | MCL_FUTURE) == 0 ? 0 : errno);
+            }
+            if (m_report.stack_prefault.requested) {
+                prefault_stack(policy.stack_prefault());
+            }
+            if (m_report.heap_prefault.requested) {
+                prefault_heap(policy.heap_prefault());
+            }
+            if (m_report.scheduler.requested) {
+                set_scheduler(policy.scheduler(), policy.priority());
+            }
+#           else
+            RealtimeSetting* settings[] = {
+                &m_report.scheduler, &m_report.memory_lock, &m_report.stack_prefault,
+                &m_report.heap_prefault, &m_report.thp_disabled};
+            for (RealtimeSetting* setting : settings) {
+                if (setting->requested) {
+                    setting->error = ENOSYS;
+                }
+            }
+#           endif
+        }
+
+        /// \brief Restores the scheduling class the thread had before.
+        ~ScopedRealtime() {
+#           if defined(__linux__)
+            if (m_report.scheduler.applied) {
+                ::pthread_setschedparam(m_thread, m_previous_policy, &m_previous_param);
+            }
+#           endif
+        }
+
+        ScopedRealtime(const ScopedRealtime&) = delete;
+        ScopedRealtime& operator=(const ScopedRealtime&) = delete;
+
+        /// \brief Returns which settings took effect.
+        const RealtimeReport& report() const {
+            return m_report;
+        }
+
+    private:
+        RealtimeReport m_report;
+#       if defined(__linux__)
+        enum : std::size_t { stack_margin = 64 * 1024 }; ///< Free stack left below a prefault.
+
+        pthread_t   m_thread{::pthread_self()};
+        int         m_previous_policy{SCHED_OTHER};
+        sched_param m_previous_param{};
+
+        static void apply(RealtimeSetting& setting, int error) {
+            setting.applied = error == 0;
+            setting.error = error;
+        }
+
+        static std::size_t page_size() {
+            const long size = ::sysconf(_SC_PAGESIZE);
+            return size > 0 ? static_cast<std::size_t>(size) : 4096;
+        }
+
+        void disable_thp() {
+#           if defined(PR_SET_THP_DISABLE)
+            apply(m_report.thp_disabled, ::prctl(PR_SET_THP_DISABLE, 1, 0, 0, 0) == 0 ? 0 : errno);
+#           else
+            apply(m_report.thp_disabled, ENOSYS);
+#           endif
+        }
+
+        /// \brief Returns the free stack below the caller's frame, or `0` if unknown.
+        static std::size_t free_stack() {
+            pthread_attr_t attributes;
+            if (::pthread_getattr_np(::pthread_self(), &attributes) != 0) {
+                return 0;
+            }
+            void* low = nullptr;
+            std::size_t size = 0;
+            const int result = ::pthread_attr_getstack(&attributes, &low, &size);
+            ::pthread_attr_destroy(&attributes);
+            if (result != 0) {
+                return 0;
+            }
+            char marker = 0;
+            const std::uintptr_t here = reinterpret_cast<std::uintptr_t>(&marker);
+            const std::uintptr_t bottom = reinterpret_cast<std::uintptr_t>(low);
+            return here > bottom ? static_cast<std::size_t>(here - bottom) : 0;
+        }
+
+        __attribute__((noinline)) static void touch_stack(std::size_t bytes, std::size_t page) {
+            volatile unsigned char* stack = static_cast<volatile unsigned char*>(alloca(bytes));
+            for (std::size_t offset = 0; offset < bytes; offset += page) {
+                stack[offset] = 0;
+            }
+            stack[bytes - 1] = 0;
+        }
+
+        void prefault_stack(std::size_t bytes) {
+            if (bytes + stack_margin > free_stack()) {
+                apply(m_report.stack_prefault, ENOMEM);
+                return;
+            }
+            touch_stack(bytes, page_size());
+            m_report.stack_bytes = bytes;
+            apply(m_report.stack_prefault, 0);
+        }
+
+        void prefault_heap(std::size_t bytes) {
+#           if defined(__GLIBC__)
+            // Keep freed memory in the arena: no trimming and no per-allocation mmap.
+            if (::mallopt(M_TRIM_THRESHOLD, -1) == 0 || ::mallopt(M_MMAP_MAX, 0) == 0) {
+                apply(m_report.heap_prefault, EINVAL);
+                return;
+            }
+            unsigned char* heap = static_cast<unsigned char*>(std::malloc(bytes));
+            if (!heap) {
+                apply(m_report.heap_prefault, ENOMEM);
+                return;
+            }
+            const std::size_t page = page_size();
+            for (std::size_t offset = 0; offset < bytes; offset += page) {
+                static_cast<volatile unsigned char*>(heap)[offset] = 0;
+            }
+            std::free(heap);
+            m_report.heap_bytes = bytes;
+            apply(m_report.heap_prefault, 0);
+#           else
+            (void)bytes;
+            apply(m_report.heap_prefault, ENOTSUP);
+#           endif
+        }
+
+        void set_scheduler(RealtimeScheduler scheduler, int priority) {
+            const int policy = scheduler == RealtimeScheduler::RoundRobin ? SCHED_RR : SCHED_FIFO;
+            const int error = ::pthread_getschedparam(m_thread, &m_previous_policy, &m_previous_param);
+            if (error != 0) {
+                apply(m_report.scheduler, error);
+                return;
+            }
+
+            const int min_priority = ::sched_get_priority_min(policy);
+            const int max_priority = ::sched_get_priority_max(policy);
+            priority = priority < min_priority ? min_priority : (priority > max_priority ? max_priority : priority);
+
+            sched_param param{};
+            param.sched_priority = priority;
+            int result = ::pthread_setschedparam(m_thread, policy, &param);
+            if (result == EPERM) {
+                // Unprivileged processes may still use priorities up to RLIMIT_RTPRIO.
+                rlimit limit;
+                if (::getrlimit(RLIMIT_RTPRIO, &limit) == 0 &&
+                    limit.rlim_cur != RLIM_INFINITY &&
+                    static_cast<long long>(limit.rlim_cur) >= min_priority &&
+                    static_cast<long long>(limit.rlim_cur) < priority) {
+                    priority = static_cast<int>(limit.rlim_cur);
+                    param.sched_priority = priority;
+                    result = ::pthread_setschedparam(m_thread, policy, &param);
+                }
+            }
+            if (result == 0) {
+                m_report.priority = priority;
+            }
+            apply(m_report.scheduler, result);
+        }
+#       endif
+    }; // ScopedRealtime
+
+} // namespace consolix
+
+#endif // _CONSOLIX_REALTIME_POLICY_HPP_INCLUDED
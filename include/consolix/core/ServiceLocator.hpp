@@ -12,22 +12,92 @@
 
 #include "std_compat.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <unordered_map>
 #include <functional>
 #include <memory>
 #include <typeindex>
 #include <stdexcept>
 #include <mutex>
+#include <vector>
 
 namespace consolix {
 
+    template <typename T>
+    class ServiceRef;
+
     /// \class ServiceLocator
     /// \brief A universal service locator for managing shared resources.
     ///
-    /// The `ServiceLocator` class implements a singleton pattern to provide
-    /// a centralized way of registering and accessing shared resources or services.
+    /// The `ServiceLocator` class provides a centralized way of registering and
+    /// accessing shared resources or services through its singleton instance.
+    ///
+    /// Lookups normally take a shared lock on the service map. After startup,
+    /// `freeze()` publishes an immutable snapshot of the registered services;
+    /// while the locator is frozen, readers search that snapshot without locks,
+    /// and `get_service()` returns a reference without touching reference counts.
+    /// Registrations made while frozen take the exclusive lock and republish the
+    /// snapshot, so the read path stays lock-free for late services as well.
+    /// Replaced snapshots stay allocated, since a lookup may still be scanning one,
+    /// until `unfreeze()` or `clear_all()`; their number is bounded by the number of
+    /// registrations made while frozen.
+    ///
+    /// Every registration and `clear_all()` bumps a generation counter, which lets
+    /// `ServiceRef` cache resolved pointers and re-resolve only after a change.
+    ///
+    /// Services registered with `register_lazy_service()` keep their factory and
+    /// are built exactly once, on first lookup or on an explicit `warm_up()`.
+    ///
+    /// Besides the process-wide instance returned by `get_instance()`, locators can
+    /// be created directly, for example one per shard of a sharded runtime. A locator
+    /// created with a parent falls back to the parent for services it does not
+    /// register itself; registrations and `clear_all()` only affect the locator they
+    /// are called on. `Scope` binds a locator to the current thread so that
+    /// `current()` and the free functions in `service_utils.hpp` resolve through it.
     class ServiceLocator {
+        template <typename T>
+        friend class ServiceRef;
     public:
+        /// \brief Registration generation type.
+        typedef std::uint64_t Generation;
+
+        /// \class Scope
+        /// \brief Binds a locator to the current thread for the lifetime of the scope.
+        class Scope {
+        public:
+            /// \brief Makes `locator` the current locator of this thread.
+            /// \param locator Locator that must outlive the scope.
+            explicit Scope(ServiceLocator& locator) :
+                m_previous(current_slot()) {
+                current_slot() = &locator;
+            }
+
+            /// \brief Restores the previously bound locator.
+            ~Scope() {
+                current_slot() = m_previous;
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            ServiceLocator* m_previous;
+        };
+
+        /// \brief Creates an empty standalone locator.
+        ServiceLocator() = default;
+
+        /// \brief Creates an empty locator that falls back to `parent` on lookup misses.
+        /// \param parent Locator that must outlive this one.
+        explicit ServiceLocator(ServiceLocator& parent) :
+            m_parent(&parent) {
+        }
+
+        /// \brief Destroys the locator and every service it owns.
+        ~ServiceLocator() = default;
 
         /// \brief Retrieves the singleton instance of the `ServiceLocator`.
         /// \return Reference to the `ServiceLocator` instance.
@@ -36,6 +106,19 @@ namespace consolix {
             return *instance;
         }
 
+        /// \brief Returns the locator bound to this thread by `Scope`.
+        /// \return The bound locator, or the singleton instance when none is bound.
+        static ServiceLocator& current() {
+            ServiceLocator* locator = current_slot();
+            return locator ? *locator : get_instance();
+        }
+
+        /// \brief Returns the parent locator.
+        /// \return Parent locator, or `nullptr` for a root locator.
+        ServiceLocator* parent() const {
+            return m_parent;
+        }
+
         /// \brief Registers a resource or service.
         /// \tparam T The type of the resource.
         /// \param creator A function to create the resource (optional).
@@ -43,16 +126,7 @@ namespace consolix {
         template <typename T>
         void register_service(std::function<std::shared_ptr<T>()> creator) {
             std::shared_ptr<T> service = creator();
-
-            std::unique_lock<compat::shared_mutex> lock(m_mutex);
-            const auto type = std::type_index(typeid(T));
-            if (m_services.find(type) != m_services.end()) {
-#               if CONSOLIX_USE_LOGIT == 1
-                LOGIT_PRINT_ERROR("Service already registered: ", std::string(typeid(T).name()));
-#               endif
-                throw std::runtime_error("Service already registered: " + std::string(typeid(T).name()));
-            }
-            m_services[type] = std::move(service);
+            insert_slot<T>(std::make_shared<ServiceSlot>(std::shared_ptr<void>(std::move(service))));
         }
 
         /// \brief Registers a resource with default construction.
@@ -60,33 +134,73 @@ namespace consolix {
         /// \throws `std::runtime_error` if the resource is already registered.
         template <typename T>
         void register_service() {
-            std::unique_lock<compat::shared_mutex> lock(m_mutex);
-            const auto type = std::type_index(typeid(T));
-            if (m_services.find(type) != m_services.end()) {
-#               if CONSOLIX_USE_LOGIT == 1
-                LOGIT_PRINT_ERROR("Service already registered: ", std::string(typeid(T).name()));
-#               endif
-                throw std::runtime_error("Service already registered: " + std::string(typeid(T).name()));
+            insert_slot<T>(std::make_shared<ServiceSlot>(std::shared_ptr<void>(std::make_shared<T>())));
+        }
+
+        /// \brief Registers a resource that is built on first use.
+        ///
+        /// The factory runs exactly once, on the first lookup of `T` or on
+        /// `warm_up()`. Concurrent first lookups wait for the same construction.
+        /// If the factory throws, the exception reaches the caller and the next
+        /// lookup retries. The factory may look up other services.
+        /// \tparam T The type of the resource.
+        /// \param factory A function to create the resource.
+        /// \throws `std::runtime_error` if the resource is already registered.
+        template <typename T>
+        void register_lazy_service(std::function<std::shared_ptr<T>()> factory) {
+            std::function<std::shared_ptr<void>()> erased_factory =
+                [factory]() -> std::shared_ptr<void> {
+                    return factory();
+                };
+            insert_slot<T>(std::make_shared<ServiceSlot>(std::move(erased_factory)));
+        }
+
+        /// \brief Registers a default-constructed resource that is built on first use.
+        /// \tparam T The type of the resource.
+        /// \throws `std::runtime_error` if the resource is already registered.
+        template <typename T>
+        void register_lazy_service() {
+            register_lazy_service<T>([]() {
+                return std::make_shared<T>();
+            });
+        }
+
+        /// \brief Builds a lazily registered resource ahead of its first lookup.
+        ///
+        /// Has no effect on resources that are already built.
+        /// \tparam T The type of the resource.
+        /// \throws `std::runtime_error` if the resource is not registered.
+        template <typename T>
+        void warm_up() {
+            (void)get_service<T>();
+        }
+
+        /// \brief Builds every lazily registered resource that is not built yet.
+        void warm_up_all() {
+            std::vector<std::shared_ptr<ServiceSlot>> slots;
+            {
+                compat::shared_lock<compat::shared_mutex> lock(m_mutex);
+                slots.reserve(m_services.size());
+                for (const auto& item : m_services) {
+                    slots.push_back(item.second);
+                }
+            }
+            for (const auto& slot : slots) {
+                (void)slot->get();
             }
-            m_services[type] = std::make_shared<T>();
         }
 
-        /// \brief Retrieves a resource from the locator.
+        /// \brief Retrieves a resource from the locator or its parents.
         /// \tparam T The type of the resource.
         /// \return Reference to the resource.
         /// \throws `std::runtime_error` if the resource is not registered.
         template <typename T>
         T& get_service() {
-            compat::shared_lock<compat::shared_mutex> lock(m_mutex);
-            const auto type = std::type_index(typeid(T));
-            auto it = m_services.find(type);
-            if (it == m_services.end()) {
-#               if CONSOLIX_USE_LOGIT == 1
-                LOGIT_PRINT_ERROR("Service not registered: ", std::string(typeid(T).name()));
-#               endif
-                throw std::runtime_error("Service not registered: " + std::string(typeid(T).name()));
+            T* service = find_raw<T>();
+            if (!service) {
+                throw_not_registered<T>();
             }
-            return *std::static_pointer_cast<T>(it->second);
+            return *service;
         }
 
         /// \brief Retrieves a shared resource pointer from the locator.
@@ -95,56 +209,311 @@ namespace consolix {
         /// \throws `std::runtime_error` if the resource is not registered.
         template <typename T>
         std::shared_ptr<T> get_service_ptr() {
-            compat::shared_lock<compat::shared_mutex> lock(m_mutex);
-            const auto type = std::type_index(typeid(T));
-            auto it = m_services.find(type);
-            if (it == m_services.end()) {
-#               if CONSOLIX_USE_LOGIT == 1
-                LOGIT_PRINT_ERROR("Service not registered: ", std::string(typeid(T).name()));
-#               endif
-                throw std::runtime_error("Service not registered: " + std::string(typeid(T).name()));
+            std::shared_ptr<T> service = find_service<T>();
+            if (!service) {
+                throw_not_registered<T>();
             }
-            return std::static_pointer_cast<T>(it->second);
+            return service;
         }
 
-        /// \brief Attempts to find a shared resource pointer.
+        /// \brief Attempts to find a shared resource pointer in the locator or its parents.
         /// \tparam T The type of the resource.
         /// \return Shared pointer to the resource, or `nullptr` when it is not registered.
         template <typename T>
         std::shared_ptr<T> find_service() {
-            compat::shared_lock<compat::shared_mutex> lock(m_mutex);
-            const auto type = std::type_index(typeid(T));
-            auto it = m_services.find(type);
-            if (it == m_services.end()) {
-                return std::shared_ptr<T>();
+            if (const Snapshot* snapshot = m_snapshot.load(std::memory_order_acquire)) {
+                if (const SnapshotEntry* entry = snapshot->find(type_key<T>())) {
+                    return std::static_pointer_cast<T>(entry->slot->owner());
+                }
+                return m_parent ? m_parent->find_service<T>() : std::shared_ptr<T>();
             }
-            return std::static_pointer_cast<T>(it->second);
+
+            std::shared_ptr<ServiceSlot> slot;
+            {
+                compat::shared_lock<compat::shared_mutex> lock(m_mutex);
+                auto it = m_services.find(type_key<T>().type);
+                if (it != m_services.end()) {
+                    slot = it->second;
+                }
+            }
+            if (!slot) {
+                return m_parent ? m_parent->find_service<T>() : std::shared_ptr<T>();
+            }
+            return std::static_pointer_cast<T>(slot->owner());
         }
 
-        /// \brief Checks if a resource is registered.
+        /// \brief Checks if a resource is registered in the locator or its parents.
+        ///
+        /// Lazily registered resources count as registered before they are built.
         /// \tparam T The type of the resource.
         /// \return `true` if the resource is registered, `false` otherwise.
         template <typename T>
         bool has_service() {
+            if (has_local_service<T>()) {
+                return true;
+            }
+            return m_parent && m_parent->has_service<T>();
+        }
+
+        /// \brief Publishes an immutable snapshot for lock-free lookups.
+        ///
+        /// Call this once startup registrations are complete. Calling it while
+        /// frozen has no effect: the snapshot already reflects every registration.
+        void freeze() {
+            std::unique_lock<compat::shared_mutex> lock(m_mutex);
+            if (m_snapshot.load(std::memory_order_relaxed) == nullptr) {
+                publish_snapshot();
+            }
+        }
+
+        /// \brief Drops the snapshots and returns lookups to the locked map.
+        ///
+        /// Frees every snapshot, so callers must not look services up concurrently.
+        void unfreeze() {
+            std::unique_lock<compat::shared_mutex> lock(m_mutex);
+            m_snapshot.store(nullptr, std::memory_order_release);
+            m_snapshots.clear();
+        }
+
+        /// \brief Checks whether lookups currently use the frozen snapshot.
+        /// \return `true` after `freeze()` and before `unfreeze()` or `clear_all()`.
+        bool is_frozen() const {
+            return m_snapshot.load(std::memory_order_acquire) != nullptr;
+        }
+
+        /// \brief Returns the number of snapshots still allocated.
+        ///
+        /// While frozen, that is the published snapshot plus one replaced snapshot per
+        /// registration made since `freeze()`; otherwise zero.
+        std::size_t retained_snapshots() {
             compat::shared_lock<compat::shared_mutex> lock(m_mutex);
-            const auto type_id = std::type_index(typeid(T));
-            return m_services.find(type_id) != m_services.end();
+            return m_snapshots.size();
         }
 
-        /// \brief Clears all registered resources.
+        /// \brief Clears all resources registered in this locator.
+        ///
+        /// Parent locators are not affected. Also unfreezes the locator. Callers must not use services concurrently
+        /// with `clear_all()`.
         void clear_all() {
             std::unique_lock<compat::shared_mutex> lock(m_mutex);
+            m_snapshot.store(nullptr, std::memory_order_release);
+            m_snapshots.clear();
             m_services.clear();
+            bump_generation();
+        }
+
+        /// \brief Returns the registration generation.
+        ///
+        /// The value changes after every successful registration and after `clear_all()`
+        /// on this locator or any of its parents.
+        /// \return Current generation value.
+        Generation generation() const {
+            const Generation generation = m_generation.load(std::memory_order_acquire);
+            return m_parent ? generation + m_parent->generation() : generation;
         }
 
     private:
+        /// \brief Owns one registered service, built eagerly or on first use.
+        class ServiceSlot {
+        public:
+            explicit ServiceSlot(std::shared_ptr<void> service) :
+                m_service(std::move(service)),
+                m_raw(m_service.get()) {
+            }
+
+            explicit ServiceSlot(std::function<std::shared_ptr<void>()> factory) :
+                m_factory(std::move(factory)),
+                m_raw(nullptr) {
+            }
+
+            /// \brief Returns the service pointer if it has been built.
+            void* get_if_built() const {
+                return m_raw.load(std::memory_order_acquire);
+            }
+
+            /// \brief Returns the service pointer, building it on first use.
+            void* get() {
+                void* service = m_raw.load(std::memory_order_acquire);
+                return service ? service : build();
+            }
+
+            /// \brief Returns the owning pointer, building the service on first use.
+            const std::shared_ptr<void>& owner() {
+                (void)get();
+                return m_service;
+            }
+
+        private:
+            std::mutex                              m_mutex;
+            std::function<std::shared_ptr<void>()>  m_factory;
+            std::shared_ptr<void>                   m_service;
+            std::atomic<void*>                      m_raw;
+
+            void* build() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_service && m_factory) {
+                    std::shared_ptr<void> service = m_factory();
+                    if (!service) {
+                        throw std::runtime_error("Lazy service factory returned null");
+                    }
+                    m_service = std::move(service);
+                    m_factory = nullptr;
+                    m_raw.store(m_service.get(), std::memory_order_release);
+                }
+                return m_service.get();
+            }
+        };
+
+        /// \brief Type identity with a precomputed hash for snapshot lookups.
+        struct TypeKey {
+            std::type_index type;
+            std::size_t     hash;
+        };
+
+        /// \brief One service in a frozen snapshot.
+        struct SnapshotEntry {
+            std::size_t     hash; ///< Cached `type.hash_code()`.
+            std::type_index type; ///< Service type.
+            ServiceSlot*    slot; ///< Slot owned by the service map.
+        };
+
+        /// \brief Immutable flat table sorted by type hash.
+        struct Snapshot {
+            std::vector<SnapshotEntry> entries;
+
+            const SnapshotEntry* find(const TypeKey& key) const {
+                auto it = std::lower_bound(
+                    entries.begin(),
+                    entries.end(),
+                    key.hash,
+                    [](const SnapshotEntry& entry, std::size_t hash) {
+                        return entry.hash < hash;
+                    });
+                for (; it != entries.end() && it->hash == key.hash; ++it) {
+                    if (it->type == key.type) {
+                        return &*it;
+                    }
+                }
+                return nullptr;
+            }
+        };
+
         std::unordered_map<
             std::type_index,
-            std::shared_ptr<void>> m_services; ///< Registered services.
+            std::shared_ptr<ServiceSlot>> m_services; ///< Registered services.
         compat::shared_mutex       m_mutex;    ///< Mutex for thread-safe access.
+        std::atomic<const Snapshot*> m_snapshot{nullptr}; ///< Published snapshot, or null when not frozen.
+        std::vector<std::unique_ptr<Snapshot>> m_snapshots; ///< Current and retired snapshots kept alive for readers.
+        std::atomic<Generation>    m_generation{1};    ///< Registration generation; `ServiceRef` starts at 0.
+        ServiceLocator*            m_parent{nullptr};  ///< Fallback locator for lookup misses.
 
-        ServiceLocator() = default;
-        ~ServiceLocator() = default;
+        /// \brief Thread-local storage for the locator bound by `Scope`.
+        static ServiceLocator*& current_slot() {
+            static thread_local ServiceLocator* locator = nullptr;
+            return locator;
+        }
+
+        template <typename T>
+        bool has_local_service() {
+            if (const Snapshot* snapshot = m_snapshot.load(std::memory_order_acquire)) {
+                return snapshot->find(type_key<T>()) != nullptr;
+            }
+
+            compat::shared_lock<compat::shared_mutex> lock(m_mutex);
+            return m_services.find(type_key<T>().type) != m_services.end();
+        }
+
+        /// \brief Returns the cached lookup key for `T`.
+        template <typename T>
+        static const TypeKey& type_key() {
+            static const TypeKey key = {std::type_index(typeid(T)), std::type_index(typeid(T)).hash_code()};
+            return key;
+        }
+
+        template <typename T>
+        [[noreturn]] static void throw_not_registered() {
+#           if CONSOLIX_USE_LOGIT == 1
+            LOGIT_PRINT_ERROR("Service not registered: ", std::string(typeid(T).name()));
+#           endif
+            throw std::runtime_error("Service not registered: " + std::string(typeid(T).name()));
+        }
+
+        /// \brief Adds a slot for `T`.
+        /// \throws `std::runtime_error` if the resource is already registered.
+        template <typename T>
+        void insert_slot(std::shared_ptr<ServiceSlot> slot) {
+            std::unique_lock<compat::shared_mutex> lock(m_mutex);
+            const auto type = type_key<T>().type;
+            if (m_services.find(type) != m_services.end()) {
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_PRINT_ERROR("Service already registered: ", std::string(typeid(T).name()));
+#               endif
+                throw std::runtime_error("Service already registered: " + std::string(typeid(T).name()));
+            }
+            m_services[type] = std::move(slot);
+            republish_if_frozen();
+            bump_generation();
+        }
+
+        /// \brief Looks up a raw service pointer in the locator or its parents.
+        /// \return Service pointer, or `nullptr` when it is not registered.
+        template <typename T>
+        T* find_raw() {
+            if (const Snapshot* snapshot = m_snapshot.load(std::memory_order_acquire)) {
+                if (const SnapshotEntry* entry = snapshot->find(type_key<T>())) {
+                    return static_cast<T*>(entry->slot->get());
+                }
+                return m_parent ? m_parent->find_raw<T>() : nullptr;
+            }
+
+            std::shared_ptr<ServiceSlot> slot;
+            {
+                compat::shared_lock<compat::shared_mutex> lock(m_mutex);
+                auto it = m_services.find(type_key<T>().type);
+                if (it == m_services.end()) {
+                    return m_parent ? m_parent->find_raw<T>() : nullptr;
+                }
+                if (void* service = it->second->get_if_built()) {
+                    return static_cast<T*>(service);
+                }
+                slot = it->second;
+            }
+            return static_cast<T*>(slot->get());
+        }
+
+        /// \brief Publishes a registration change. Requires the exclusive lock.
+        void bump_generation() {
+            m_generation.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        /// \brief Builds and publishes a snapshot. Requires the exclusive lock.
+        ///
+        /// Earlier snapshots stay allocated until `unfreeze()` or `clear_all()` because
+        /// lock-free readers may still be scanning them.
+        void publish_snapshot() {
+            std::unique_ptr<Snapshot> snapshot(new Snapshot());
+            snapshot->entries.reserve(m_services.size());
+            for (const auto& item : m_services) {
+                SnapshotEntry entry = {item.first.hash_code(), item.first, item.second.get()};
+                snapshot->entries.push_back(entry);
+            }
+            std::sort(
+                snapshot->entries.begin(),
+                snapshot->entries.end(),
+                [](const SnapshotEntry& lhs, const SnapshotEntry& rhs) {
+                    return lhs.hash < rhs.hash;
+                });
+
+            m_snapshot.store(snapshot.get(), std::memory_order_release);
+            m_snapshots.push_back(std::move(snapshot));
+        }
+
+        /// \brief Republishes the snapshot after a late registration. Requires the exclusive lock.
+        void republish_if_frozen() {
+            if (m_snapshot.load(std::memory_order_relaxed) != nullptr) {
+                publish_snapshot();
+            }
+        }
 
         // Delete copy and move constructors and assignment operators.
         ServiceLocator(const ServiceLocator&) = delete;
@@ -0,0 +1,100 @@
+#pragma once
+#ifndef _CONSOLIX_SERVICE_REF_HPP_INCLUDED
+#define _CONSOLIX_SERVICE_REF_HPP_INCLUDED
+
+/// \file ServiceRef.hpp
+/// \brief Cached service handle that re-resolves only after locator changes.
+/// \ingroup Core
+
+#include "ServiceLocator.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+namespace consolix {
+
+    /// \class ServiceRef
+    /// \brief Caches a raw service pointer resolved from a `ServiceLocator`.
+    ///
+    /// The handle resolves the service on first use and then compares the
+    /// locator generation on each access. The generation changes only on
+    /// registration and `clear_all()`, so a hot loop pays one atomic load instead
+    /// of a map lookup or a `weak_ptr::lock()`.
+    ///
+    /// A default-constructed handle binds to `ServiceLocator::current()` on first
+    /// use, so a handle declared as a component member resolves through the
+    /// locator of the runner that initializes the component.
+    ///
+    /// The handle does not own the service. A `ServiceRef` instance is not
+    /// thread-safe; keep one handle per owning thread.
+    /// \tparam T Service type.
+    template <typename T>
+    class ServiceRef {
+    public:
+        /// \brief Creates a handle bound to the current locator on first use.
+        ServiceRef() = default;
+
+        /// \brief Creates a handle bound to a specific locator.
+        /// \param locator Locator that must outlive this handle.
+        explicit ServiceRef(ServiceLocator& locator) :
+            m_locator(&locator) {
+        }
+
+        /// \brief Returns the service, re-resolving it after locator changes.
+        /// \return Service pointer, or `nullptr` when it is not registered.
+        T* get() {
+            if (!m_locator) {
+                m_locator = &ServiceLocator::current();
+            }
+            const ServiceLocator::Generation generation = m_locator->generation();
+            if (generation != m_generation) {
+                m_service = m_locator->find_raw<T>();
+                m_generation = generation;
+            }
+            return m_service;
+        }
+
+        /// \brief Returns the service reference.
+        /// \return Reference to the service.
+        /// \throws std::runtime_error if the service is not registered.
+        T& operator*() {
+            T* service = get();
+            if (!service) {
+                throw std::runtime_error("Service not registered: " + std::string(typeid(T).name()));
+            }
+            return *service;
+        }
+
+        /// \brief Accesses service members.
+        /// \throws std::runtime_error if the service is not registered.
+        T* operator->() {
+            return &**this;
+        }
+
+        /// \brief Checks whether the service is currently registered.
+        explicit operator bool() {
+            return get() != nullptr;
+        }
+
+        /// \brief Returns the locator the handle resolves through.
+        /// \return Bound locator, or `nullptr` before the first use of a default handle.
+        ServiceLocator* locator() const {
+            return m_locator;
+        }
+
+        /// \brief Forces the next access to resolve the service again.
+        void reset() {
+            m_service = nullptr;
+            m_generation = 0;
+        }
+
+    private:
+        ServiceLocator*            m_locator{nullptr};
+        T*                         m_service{nullptr};
+        ServiceLocator::Generation m_generation{0};
+    }; // ServiceRef
+
+} // namespace consolix
+
+#endif // _CONSOLIX_SERVICE_REF_HPP_INCLUDED
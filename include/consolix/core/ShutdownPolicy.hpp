@@ -0,0 +1,126 @@
+#pragma once
+#ifndef _CONSOLIX_SHUTDOWN_POLICY_HPP_INCLUDED
+#define _CONSOLIX_SHUTDOWN_POLICY_HPP_INCLUDED
+
+/// \file ShutdownPolicy.hpp
+/// \brief Deadlines and parallelism for component shutdown, and the resulting report.
+/// \ingroup Core
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace consolix {
+
+    /// \class ShutdownPolicy
+    /// \brief Limits how long `AppComponentManager::shutdown()` may take.
+    ///
+    /// The default policy shuts components down one at a time, in reverse order, on
+    /// the calling thread and without time limits. A bounded policy runs each
+    /// `IShutdownable::shutdown()` on its own thread so the manager can stop waiting:
+    /// a component that overruns its deadline is logged, marked as timed out in the
+    /// `ShutdownReport` and left running while shutdown continues with the others.
+    /// Its thread keeps the component alive and uses the manager's locator, so
+    /// `ConsoleApplicationRunner` skips `ServiceLocator::clear_all()` and the LogIt
+    /// shutdown while `running_shutdown_tasks()` is nonzero.
+    /// Once the total deadline passes, components that have not started are skipped.
+    ///
+    /// With more than one thread, components implementing `IInitDependencies` shut down
+    /// in parallel waves: a component waits only for the components that depend on it.
+    /// Components without declared dependencies act as sequential barriers.
+    class ShutdownPolicy {
+    public:
+        /// \brief Creates the default sequential policy without deadlines.
+        ShutdownPolicy() = default;
+
+        /// \brief Returns the default sequential policy without deadlines.
+        static ShutdownPolicy unbounded() {
+            return ShutdownPolicy();
+        }
+
+        /// \brief Creates a policy with deadlines.
+        /// \param component_timeout Time limit for one component; `0` means no limit.
+        /// \param total_timeout Time limit for the whole shutdown; `0` means no limit.
+        /// \param threads Maximum number of components shutting down at once.
+        static ShutdownPolicy bounded(
+                std::chrono::milliseconds component_timeout,
+                std::chrono::milliseconds total_timeout,
+                std::size_t threads = 1) {
+            ShutdownPolicy policy;
+            policy.m_component_timeout = component_timeout;
+            policy.m_total_timeout = total_timeout;
+            policy.m_threads = threads;
+            return policy;
+        }
+
+        /// \brief Returns the time limit for one component; `0` means no limit.
+        std::chrono::milliseconds component_timeout() const {
+            return m_component_timeout;
+        }
+
+        /// \brief Returns the time limit for the whole shutdown; `0` means no limit.
+        std::chrono::milliseconds total_timeout() const {
+            return m_total_timeout;
+        }
+
+        /// \brief Returns the maximum number of components shutting down at once.
+        std::size_t threads() const {
+            return m_threads;
+        }
+
+        /// \brief Checks whether shutdown runs on helper threads.
+        bool uses_threads() const {
+            return m_threads > 1 ||
+                   m_component_timeout > std::chrono::milliseconds(0) ||
+                   m_total_timeout > std::chrono::milliseconds(0);
+        }
+
+    private:
+        std::chrono::milliseconds m_component_timeout{0};
+        std::chrono::milliseconds m_total_timeout{0};
+        std::size_t               m_threads{1};
+    }; // ShutdownPolicy
+
+    /// \struct ComponentShutdownTiming
+    /// \brief Outcome of one component's shutdown.
+    struct ComponentShutdownTiming {
+        std::size_t               index{0};        ///< Registration index of the component.
+        std::string               name;            ///< Implementation-defined type name.
+        std::chrono::microseconds duration{0};     ///< Time spent, or waited before giving up.
+        bool                      timed_out{false}; ///< Overran its deadline and was left running.
+        bool                      skipped{false};  ///< Not started because the total deadline passed.
+        bool                      failed{false};   ///< Threw an exception.
+        std::string               error;           ///< Exception message when `failed`.
+    };
+
+    /// \struct ShutdownReport
+    /// \brief Timings of the last `shutdown()` call, one entry per component.
+    struct ShutdownReport {
+        std::vector<ComponentShutdownTiming> components; ///< Entries in registration order.
+        std::chrono::microseconds            total{0};   ///< Wall time of the whole shutdown.
+
+        /// \brief Checks whether any component overran or was skipped.
+        bool timed_out() const {
+            for (const auto& component : components) {
+                if (component.timed_out || component.skipped) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// \brief Checks whether any component threw.
+        bool failed() const {
+            for (const auto& component : components) {
+                if (component.failed) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+} // namespace consolix
+
+#endif // _CONSOLIX_SHUTDOWN_POLICY_HPP_INCLUDED
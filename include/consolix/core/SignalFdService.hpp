@@ -0,0 +1,225 @@
+#pragma once
+#ifndef _CONSOLIX_SIGNAL_FD_SERVICE_HPP_INCLUDED
+#define _CONSOLIX_SIGNAL_FD_SERVICE_HPP_INCLUDED
+
+/// \file SignalFdService.hpp
+/// \brief signalfd-based signal delivery for the runner's reactor mode (Linux only).
+/// \ingroup Core
+
+#include <csignal>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
+#endif
+
+namespace consolix {
+
+    /// \class SignalFdService
+    /// \brief Blocks a signal set and reads it synchronously from a `signalfd`.
+    ///
+    /// Unlike `PosixSignalWakeService`, no signal handler, self-pipe or watcher thread
+    /// is involved: the watched signals stay pending until the descriptor is read, and
+    /// the runner's `Reactor` waits on the descriptor directly. Termination signals
+    /// (`SIGINT` and `SIGTERM` by default) stop the runner with the signal number as
+    /// exit code; other watched signals (`SIGHUP`, `SIGUSR1` and `SIGUSR2` by default)
+    /// go to `ISignalSubscriber` components.
+    ///
+    /// Signal masks are per thread. `start()` blocks the set on the calling thread only,
+    /// so threads created before it keep receiving the signals through ordinary handlers.
+    /// Start the service (or call `block_on_current_thread()`) early in `main()` to make
+    /// new threads inherit the blocked mask.
+    ///
+    /// This service is Linux-only. Elsewhere `start()` returns `false`.
+    class SignalFdService {
+    public:
+        /// \brief Constructs a service watching the default signal set.
+        /// \param default_signals Whether to watch `SIGINT`/`SIGTERM` as termination
+        /// signals and `SIGHUP`/`SIGUSR1`/`SIGUSR2` as dispatched signals.
+        explicit SignalFdService(bool default_signals = true) {
+#if defined(__linux__)
+            sigemptyset(&m_watched);
+            sigemptyset(&m_terminating);
+            sigemptyset(&m_previous_mask);
+            if (default_signals) {
+                watch(SIGINT, true);
+                watch(SIGTERM, true);
+                watch(SIGHUP);
+                watch(SIGUSR1);
+                watch(SIGUSR2);
+            }
+#else
+            (void)default_signals;
+#endif
+        }
+
+        /// \brief Stops the service if it is still running.
+        ~SignalFdService() {
+            stop();
+        }
+
+        SignalFdService(const SignalFdService&) = delete;
+        SignalFdService& operator=(const SignalFdService&) = delete;
+
+        /// \brief Returns whether this platform supports signalfd.
+        /// \return `true` on Linux.
+        bool is_supported() const {
+#if defined(__linux__)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /// \brief Adds a signal to the watched set.
+        /// \param signal_number Signal to watch.
+        /// \param terminates Whether the signal stops the runner instead of being dispatched.
+        /// \throws std::logic_error If the service is already running.
+        /// \throws std::invalid_argument If the signal number is invalid.
+        void watch(int signal_number, bool terminates = false) {
+#if defined(__linux__)
+            if (m_fd >= 0) {
+                throw std::logic_error("SignalFdService: cannot change signals while running");
+            }
+            if (sigaddset(&m_watched, signal_number) != 0) {
+                throw std::invalid_argument("SignalFdService: invalid signal " + std::to_string(signal_number));
+            }
+            if (terminates) {
+                sigaddset(&m_terminating, signal_number);
+            } else {
+                sigdelset(&m_terminating, signal_number);
+            }
+#else
+            (void)signal_number;
+            (void)terminates;
+#endif
+        }
+
+        /// \brief Checks whether a signal is in the watched set.
+        bool watches(int signal_number) const {
+#if defined(__linux__)
+            return sigismember(&m_watched, signal_number) == 1;
+#else
+            (void)signal_number;
+            return false;
+#endif
+        }
+
+        /// \brief Checks whether a watched signal stops the runner.
+        bool terminates(int signal_number) const {
+#if defined(__linux__)
+            return sigismember(&m_terminating, signal_number) == 1;
+#else
+            (void)signal_number;
+            return false;
+#endif
+        }
+
+        /// \brief Blocks the watched set on the calling thread without creating the descriptor.
+        ///
+        /// Call this at the top of `main()` so that threads created later inherit the mask
+        /// and the signals are only ever consumed through the descriptor.
+        void block_on_current_thread() const {
+#if defined(__linux__)
+            pthread_sigmask(SIG_BLOCK, &m_watched, nullptr);
+#endif
+        }
+
+        /// \brief Blocks the watched signals on the calling thread and opens the descriptor.
+        /// \return `true` when running, `false` on unsupported platforms.
+        /// \throws std::runtime_error If the mask or the descriptor cannot be set up.
+        bool start() {
+#if defined(__linux__)
+            if (m_fd >= 0) {
+                return true;
+            }
+            if (pthread_sigmask(SIG_BLOCK, &m_watched, &m_previous_mask) != 0) {
+                throw std::runtime_error("SignalFdService: pthread_sigmask failed");
+            }
+            m_fd = ::signalfd(-1, &m_watched, SFD_NONBLOCK | SFD_CLOEXEC);
+            if (m_fd < 0) {
+                const int error = errno;
+                pthread_sigmask(SIG_SETMASK, &m_previous_mask, nullptr);
+                throw std::runtime_error("SignalFdService: signalfd failed, errno " + std::to_string(error));
+            }
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /// \brief Discards pending watched signals, restores the previous mask and closes the descriptor.
+        ///
+        /// Must be called on the thread that called `start()`.
+        void stop() {
+#if defined(__linux__)
+            if (m_fd < 0) {
+                return;
+            }
+            read_pending([](int) {});
+            ::close(m_fd);
+            m_fd = -1;
+            pthread_sigmask(SIG_SETMASK, &m_previous_mask, nullptr);
+#endif
+        }
+
+        /// \brief Checks whether the descriptor is open.
+        bool is_running() const {
+            return m_fd >= 0;
+        }
+
+        /// \brief Returns the pollable descriptor, or `-1` when not running.
+        int fd() const {
+            return m_fd;
+        }
+
+        /// \brief Reads every pending signal without blocking.
+        /// \tparam Handler Callable taking the signal number.
+        /// \param handler Called once per delivered signal, in delivery order.
+        /// \return Number of signals read.
+        template <typename Handler>
+        std::size_t read_pending(Handler handler) {
+            std::size_t count = 0;
+#if defined(__linux__)
+            if (m_fd < 0) {
+                return 0;
+            }
+            signalfd_siginfo info[8];
+            while (true) {
+                const ssize_t bytes = ::read(m_fd, info, sizeof(info));
+                if (bytes <= 0) {
+                    if (bytes < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    break;
+                }
+                const std::size_t received = static_cast<std::size_t>(bytes) / sizeof(signalfd_siginfo);
+                for (std::size_t i = 0; i < received; ++i) {
+                    handler(static_cast<int>(info[i].ssi_signo));
+                }
+                count += received;
+            }
+#else
+            (void)handler;
+#endif
+            return count;
+        }
+
+    private:
+        int      m_fd{-1};
+#if defined(__linux__)
+        sigset_t m_watched;
+        sigset_t m_terminating;
+        sigset_t m_previous_mask;
+#endif
+    }; // SignalFdService
+
+} // namespace consolix
+
+#endif // _CONSOLIX_SIGNAL_FD_SERVICE_HPP_INCLUDED
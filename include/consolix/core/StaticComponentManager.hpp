@@ -0,0 +1,351 @@
+#pragma once
+#ifndef _CONSOLIX_STATIC_COMPONENT_MANAGER_HPP_INCLUDED
+#define _CONSOLIX_STATIC_COMPONENT_MANAGER_HPP_INCLUDED
+
+/// \file StaticComponentManager.hpp
+/// \brief Manages a fixed set of components resolved at compile time.
+/// \ingroup Core
+
+#include <bitset>
+#include <cstddef>
+#include <exception>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if CONSOLIX_USE_LOGIT == 1
+#include <logit.hpp>
+#endif
+
+#include "ServiceLocator.hpp"
+
+namespace consolix {
+
+    namespace detail {
+
+        /// \brief Checks that every type in a pack derives from `IAppComponent`.
+        template <typename... Components>
+        struct all_app_components : std::true_type {};
+
+        template <typename Component, typename... Rest>
+        struct all_app_components<Component, Rest...> : std::integral_constant<bool,
+            std::is_base_of<IAppComponent, Component>::value &&
+            all_app_components<Rest...>::value> {};
+
+        /// \brief Checks whether any type in a pack derives from `IWorkReporter`.
+        template <typename... Components>
+        struct any_work_reporter : std::false_type {};
+
+        template <typename Component, typename... Rest>
+        struct any_work_reporter<Component, Rest...> : std::integral_constant<bool,
+            std::is_base_of<IWorkReporter, Component>::value ||
+            any_work_reporter<Rest...>::value> {};
+
+        /// \brief Finds the index of `T` in a type pack.
+        template <typename T, typename... Components>
+        struct component_index;
+
+        template <typename T, typename... Rest>
+        struct component_index<T, T, Rest...> : std::integral_constant<std::size_t, 0> {};
+
+        template <typename T, typename Component, typename... Rest>
+        struct component_index<T, Component, Rest...> : std::integral_constant<std::size_t,
+            1 + component_index<T, Rest...>::value> {};
+
+    } // namespace detail
+
+    /// \class StaticComponentManager
+    /// \brief Drives a fixed list of components stored by value in a `std::tuple`.
+    ///
+    /// The dynamic `AppComponentManager` walks a vector of `std::shared_ptr<IAppComponent>`
+    /// and makes an indirect call per component per pass. This manager knows the exact
+    /// component types, so `initialize()`, `process()` and `shutdown()` expand into a
+    /// straight sequence of calls on objects the compiler can see, which lets it resolve
+    /// and inline them. Components are kept contiguously inside the manager.
+    ///
+    /// Lifecycle semantics match `AppComponentManager`: components initialize and process
+    /// in declaration order, components that reported ready are not polled again, and
+    /// `shutdown()` runs in reverse order on components deriving from `IShutdownable`
+    /// and continues after errors. The manager implements
+    /// `IComponentManager`, so it plugs into `ConsoleApplicationRunner` directly.
+    ///
+    /// ```cpp
+    /// consolix::StaticComponentManager<Producer, Consumer, consolix::LoopThrottleComponent> manager;
+    /// manager.get<Producer>().set_source("input.bin");
+    /// consolix::ConsoleApplicationRunner runner(manager);
+    /// return runner.run_for_exit_code();
+    /// ```
+    /// \tparam Components Component types; each must derive from `IAppComponent`.
+    template <typename... Components>
+    class StaticComponentManager : public IComponentManager {
+        static_assert(detail::all_app_components<Components...>::value,
+                      "StaticComponentManager components must derive from IAppComponent");
+    public:
+        /// \brief Number of managed components.
+        static constexpr std::size_t component_count = sizeof...(Components);
+
+        /// \brief Constructs default-constructed components bound to the global locator.
+        StaticComponentManager() :
+            m_locator(&ServiceLocator::get_instance()) {
+        }
+
+        /// \brief Constructs default-constructed components bound to a specific locator.
+        /// \param locator Locator that must outlive the manager.
+        explicit StaticComponentManager(ServiceLocator& locator) :
+            m_locator(&locator) {
+        }
+
+        /// \brief Constructs each component from the matching argument.
+        /// \param locator Locator that must outlive the manager.
+        /// \param args One constructor argument per component, in declaration order.
+        template <typename... Args>
+        StaticComponentManager(ServiceLocator& locator, Args&&... args) :
+            m_components(std::forward<Args>(args)...),
+            m_locator(&locator) {
+            static_assert(sizeof...(Args) == sizeof...(Components),
+                          "StaticComponentManager needs one argument per component");
+        }
+
+        StaticComponentManager(const StaticComponentManager&) = delete;
+        StaticComponentManager& operator=(const StaticComponentManager&) = delete;
+
+        /// \brief Returns the component at position `Index`.
+        template <std::size_t Index>
+        typename std::tuple_element<Index, std::tuple<Components...>>::type& get() {
+            return std::get<Index>(m_components);
+        }
+
+        /// \brief Returns the component of type `Component`.
+        template <typename Component>
+        Component& get() {
+            return std::get<detail::component_index<Component, Components...>::value>(m_components);
+        }
+
+        /// \brief Returns the locator the manager is bound to.
+        /// \return Reference to the bound locator.
+        ServiceLocator& service_locator() const override {
+            return *m_locator;
+        }
+
+        /// \brief Initializes all components that are not initialized yet.
+        /// \return `true` if all components are initialized successfully, `false` otherwise.
+        /// \throws std::exception If any component fails during initialization.
+        bool initialize() override {
+            ServiceLocator::Scope scope(*m_locator);
+            try {
+                initialize_from<0>();
+                return m_ready.all();
+            } catch (const std::exception& e) {
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_PRINT_FATAL("Initialization error: ", e.what());
+#               endif
+                throw;
+            }
+        }
+
+        /// \brief Checks if all components are initialized.
+        /// \return `true` if all components are initialized, `false` otherwise.
+        bool is_initialized() const override {
+            if (m_ready.all()) {
+                return true;
+            }
+            return is_initialized_from<0>();
+        }
+
+        /// \brief Executes one pass over all components.
+        /// \throws std::exception If any component fails during execution.
+        void process() override {
+            try {
+                process_from<0>();
+            } catch (const std::exception& e) {
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_PRINT_FATAL("Processing error: ", e.what());
+#               endif
+                throw;
+            }
+        }
+
+        /// \brief Checks whether any component type implements `IWorkReporter`.
+        /// \return `true` if `last_work_count()` carries information.
+        bool reports_work() const override {
+            return detail::any_work_reporter<Components...>::value;
+        }
+
+        /// \brief Returns the work reported by components in the last pass.
+        /// \return Sum of `IWorkReporter::last_work_count()` values.
+        std::size_t last_work_count() const override {
+            return work_count_from<0>();
+        }
+
+        /// \brief Passes a signal to every component type implementing `ISignalSubscriber`.
+        /// \param signal_number Delivered signal number.
+        /// \return Number of components notified.
+        std::size_t dispatch_signal(int signal_number) override {
+            return dispatch_signal_from<0>(signal_number);
+        }
+
+        /// \brief Shuts down components in reverse order with "soft shutdown" support.
+        ///
+        /// Errors are logged and collected; the remaining components are still shut down.
+        /// \param signal The signal to pass to the shutdown method.
+        void shutdown(int signal) override {
+#           if CONSOLIX_USE_LOGIT == 1
+            LOGIT_PRINT_INFO("Starting shutdown with signal: ", signal);
+#           endif
+            ServiceLocator::Scope scope(*m_locator);
+            std::vector<std::string> errors;
+            shutdown_from<sizeof...(Components)>(signal, errors);
+
+            if (!errors.empty()) {
+#               if CONSOLIX_USE_LOGIT == 1
+                std::string summary = std::accumulate(
+                    errors.begin(), errors.end(), std::string(),
+                    [](const std::string& acc, const std::string& error) {
+                        return acc.empty() ? error : acc + "; " + error;
+                    }
+                );
+                LOGIT_PRINT_FATAL("Shutdown completed with errors. Summary: ", summary);
+#               endif
+            }
+        }
+
+    private:
+        std::tuple<Components...> m_components; ///< Components in declaration order.
+        ServiceLocator*           m_locator;    ///< Locator made current during initialization and shutdown.
+        std::bitset<sizeof...(Components)> m_ready; ///< Components that reported ready.
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index < sizeof...(Components))>::type initialize_from() {
+            if (!m_ready.test(Index)) {
+                IAppComponent& component = std::get<Index>(m_components);
+                if (!component.is_initialized()) {
+                    component.initialize();
+                }
+                if (component.is_initialized()) {
+                    m_ready.set(Index);
+                }
+            }
+            initialize_from<Index + 1>();
+        }
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index == sizeof...(Components))>::type initialize_from() {}
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index < sizeof...(Components)), bool>::type is_initialized_from() const {
+            const IAppComponent& component = std::get<Index>(m_components);
+            return (m_ready.test(Index) || component.is_initialized()) && is_initialized_from<Index + 1>();
+        }
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index == sizeof...(Components)), bool>::type is_initialized_from() const {
+            return true;
+        }
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index < sizeof...(Components))>::type process_from() {
+            IAppComponent& component = std::get<Index>(m_components);
+            component.process();
+            process_from<Index + 1>();
+        }
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index == sizeof...(Components))>::type process_from() {}
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index < sizeof...(Components)), std::size_t>::type work_count_from() const {
+            typedef typename std::tuple_element<Index, std::tuple<Components...>>::type Component;
+            return work_count(
+                std::get<Index>(m_components),
+                std::integral_constant<bool, std::is_base_of<IWorkReporter, Component>::value>()) +
+                work_count_from<Index + 1>();
+        }
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index == sizeof...(Components)), std::size_t>::type work_count_from() const {
+            return 0;
+        }
+
+        template <typename Component>
+        static std::size_t work_count(const Component& component, std::true_type) {
+            const IWorkReporter& reporter = component;
+            return reporter.last_work_count();
+        }
+
+        template <typename Component>
+        static std::size_t work_count(const Component&, std::false_type) {
+            return 0;
+        }
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index < sizeof...(Components)), std::size_t>::type dispatch_signal_from(int signal_number) {
+            typedef typename std::tuple_element<Index, std::tuple<Components...>>::type Component;
+            const std::size_t notified = dispatch_signal_to(
+                std::get<Index>(m_components),
+                signal_number,
+                std::integral_constant<bool, std::is_base_of<ISignalSubscriber, Component>::value>());
+            return notified + dispatch_signal_from<Index + 1>(signal_number);
+        }
+
+        template <std::size_t Index>
+        typename std::enable_if<(Index == sizeof...(Components)), std::size_t>::type dispatch_signal_from(int) {
+            return 0;
+        }
+
+        template <typename Component>
+        static std::size_t dispatch_signal_to(Component& component, int signal_number, std::true_type) {
+            ISignalSubscriber& subscriber = component;
+            subscriber.on_signal(signal_number);
+            return 1;
+        }
+
+        template <typename Component>
+        static std::size_t dispatch_signal_to(Component&, int, std::false_type) {
+            return 0;
+        }
+
+        template <std::size_t Remaining>
+        typename std::enable_if<(Remaining > 0)>::type shutdown_from(int signal, std::vector<std::string>& errors) {
+            const std::size_t index = Remaining - 1;
+            typedef typename std::tuple_element<Remaining - 1, std::tuple<Components...>>::type Component;
+            try {
+                shutdown_component(
+                    std::get<Remaining - 1>(m_components),
+                    signal,
+                    std::integral_constant<bool, std::is_base_of<IShutdownable, Component>::value>());
+            } catch (const std::exception& e) {
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_PRINT_FATAL("Component [", index, "] shutdown error: ", e.what());
+#               endif
+                errors.push_back("Component [" + std::to_string(index) + "] error: " + e.what());
+            } catch (...) {
+#               if CONSOLIX_USE_LOGIT == 1
+                LOGIT_PRINT_FATAL("Component [", index, "] shutdown error: Unknown error");
+#               endif
+                errors.push_back("Component [" + std::to_string(index) + "] error: Unknown error");
+            }
+            shutdown_from<Remaining - 1>(signal, errors);
+        }
+
+        template <std::size_t Remaining>
+        typename std::enable_if<(Remaining == 0)>::type shutdown_from(int, std::vector<std::string>&) {}
+
+        template <typename Component>
+        static void shutdown_component(Component& component, int signal, std::true_type) {
+            IShutdownable& shutdownable = component;
+            shutdownable.shutdown(signal);
+        }
+
+        template <typename Component>
+        static void shutdown_component(Component&, int, std::false_type) {}
+    }; // StaticComponentManager
+
+    template <typename... Components>
+    constexpr std::size_t StaticComponentManager<Components...>::component_count;
+
+} // namespace consolix
+
+#endif // _CONSOLIX_STATIC_COMPONENT_MANAGER_HPP_INCLUDED
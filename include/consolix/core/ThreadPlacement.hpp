@@ -0,0 +1,338 @@
+#pragma once
+#ifndef _CONSOLIX_THREAD_PLACEMENT_HPP_INCLUDED
+#define _CONSOLIX_THREAD_PLACEMENT_HPP_INCLUDED
+
+/// \file ThreadPlacement.hpp
+/// \brief Declarative CPU placement and naming for the threads Consolix creates.
+/// \ingroup Core
+
+#include "CpuTopology.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace consolix {
+
+    /// \class ThreadPlacementPolicy
+    /// \brief Describes where helper threads go relative to the loop thread's core.
+    ///
+    /// The anchor is the CPU the loop thread runs on. Helper threads never share it
+    /// and are spread so that as few of them as possible share a CPU. The rules refine
+    /// the choice: `avoid_smt_sibling()` keeps helpers off the anchor's hardware
+    /// siblings and off each other's, `same_cache()` prefers CPUs sharing the anchor's
+    /// last-level cache, and `numa_local()` prefers the anchor's NUMA node. Rules are
+    /// preferences: when no CPU satisfies all of them, the best remaining CPU is used.
+    class ThreadPlacementPolicy {
+    public:
+        /// \brief Creates a policy that only names threads and pins nothing.
+        ThreadPlacementPolicy() = default;
+
+        /// \brief Returns a policy that only names threads.
+        static ThreadPlacementPolicy disabled() {
+            return ThreadPlacementPolicy();
+        }
+
+        /// \brief Keeps helpers off the anchor core and its SMT siblings, spread over
+        /// the rest of the machine.
+        /// \param anchor Loop thread CPU; negative uses the runner's busy-poll core.
+        static ThreadPlacementPolicy isolated(int anchor = -1) {
+            ThreadPlacementPolicy policy;
+            policy.m_enabled = true;
+            policy.m_anchor = anchor;
+            policy.m_avoid_smt_sibling = true;
+            return policy;
+        }
+
+        /// \brief Keeps helpers near the anchor without sharing its core: same
+        /// last-level cache and NUMA node, no SMT siblings.
+        /// \param anchor Loop thread CPU; negative uses the runner's busy-poll core.
+        static ThreadPlacementPolicy near(int anchor = -1) {
+            ThreadPlacementPolicy policy = isolated(anchor);
+            policy.m_same_cache = true;
+            policy.m_numa_local = true;
+            return policy;
+        }
+
+        /// \brief Sets the loop thread CPU; negative uses the runner's busy-poll core.
+        ThreadPlacementPolicy& set_anchor(int cpu) {
+            m_anchor = cpu;
+            return *this;
+        }
+
+        /// \brief Prefers CPUs sharing the anchor's last-level cache.
+        ThreadPlacementPolicy& set_same_cache(bool enabled) {
+            m_same_cache = enabled;
+            return *this;
+        }
+
+        /// \brief Avoids SMT siblings of the anchor and of other placed threads.
+        ThreadPlacementPolicy& set_avoid_smt_sibling(bool enabled) {
+            m_avoid_smt_sibling = enabled;
+            return *this;
+        }
+
+        /// \brief Prefers CPUs on the anchor's NUMA node.
+        ThreadPlacementPolicy& set_numa_local(bool enabled) {
+            m_numa_local = enabled;
+            return *this;
+        }
+
+        /// \brief Returns whether threads are pinned.
+        bool enabled() const {
+            return m_enabled;
+        }
+
+        /// \brief Returns the loop thread CPU, or a negative value when unset.
+        int anchor() const {
+            return m_anchor;
+        }
+
+        /// \brief Returns whether the anchor's last-level cache is preferred.
+        bool same_cache() const {
+            return m_same_cache;
+        }
+
+        /// \brief Returns whether SMT siblings are avoided.
+        bool avoid_smt_sibling() const {
+            return m_avoid_smt_sibling;
+        }
+
+        /// \brief Returns whether the anchor's NUMA node is preferred.
+        bool numa_local() const {
+            return m_numa_local;
+        }
+
+    private:
+        bool m_enabled{false};
+        int  m_anchor{-1};
+        bool m_same_cache{false};
+        bool m_avoid_smt_sibling{false};
+        bool m_numa_local{false};
+    }; // ThreadPlacementPolicy
+
+    /// \struct ThreadAssignment
+    /// \brief Where one placed thread went.
+    struct ThreadAssignment {
+        std::string name;            ///< Thread name.
+        int         cpu{-1};         ///< Chosen CPU, or `-1` when none was chosen.
+        bool        pinned{false};   ///< Whether pinning succeeded.
+        bool        named{false};    ///< Whether the OS accepted the name.
+        bool        released{false}; ///< Whether the thread has exited, so it no longer counts as load.
+    };
+
+    /// \class ThreadPlacement
+    /// \brief Service that pins and names threads as they start.
+    ///
+    /// Consolix threads look the service up when they are created: the
+    /// `PosixSignalWakeService` watcher, `ForkJoinPool` workers used by parallel
+    /// initialization and processing, and shutdown helper threads. Each calls
+    /// `place_current_thread()` first thing, which names it and, if the policy is
+    /// enabled, pins it to the CPU chosen for it, and keeps the returned `PlacedThread`
+    /// until it exits. The assignment is then released, so pools recreated later are
+    /// spread over the CPUs their predecessors left. Without the service, threads are
+    /// only named.
+    ///
+    /// Threads created by other libraries, such as LogIt's asynchronous logger, are
+    /// not reachable. They inherit the affinity of the thread that creates them; the
+    /// runner keeps the loop thread off the anchor while components initialize, so
+    /// threads started then do not land on the anchor.
+    class ThreadPlacement {
+    public:
+        /// \brief Creates a placement over the current machine's topology.
+        explicit ThreadPlacement(const ThreadPlacementPolicy& policy = ThreadPlacementPolicy()) :
+            m_policy(policy) {
+        }
+
+        /// \brief Creates a placement over a given topology.
+        ThreadPlacement(const ThreadPlacementPolicy& policy, const CpuTopology& topology) :
+            m_policy(policy), m_topology(topology) {
+        }
+
+        /// \brief Returns the policy.
+        const ThreadPlacementPolicy& policy() const {
+            return m_policy;
+        }
+
+        /// \brief Returns the topology placement decisions are based on.
+        const CpuTopology& topology() const {
+            return m_topology;
+        }
+
+        /// \brief Chooses a CPU for the next thread and records it.
+        ///
+        /// Does not touch the calling thread, so it can be used to plan placements. The
+        /// reservation counts as load until `release()` is called with its index.
+        /// \param name Thread name recorded with the assignment.
+        /// \return The chosen CPU, or `-1` if the policy is disabled or only the anchor is online.
+        int reserve_cpu(const std::string& name) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_assignments[reserve(name)].cpu;
+        }
+
+        /// \brief Names the calling thread and pins it according to the policy.
+        ///
+        /// Threads normally use the free `place_current_thread()`, whose handle calls
+        /// `release()` when the thread exits.
+        /// \param name Thread name; Linux keeps the first 15 characters.
+        /// \return Index of the recorded assignment in `assignments()`.
+        std::size_t place_current_thread(const std::string& name) {
+            std::size_t index = 0;
+            int cpu = -1;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                index = reserve(name);
+                cpu = m_assignments[index].cpu;
+            }
+            const bool pinned = cpu >= 0 && pin_current_thread(cpu);
+            const bool named = set_current_thread_name(name);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_assignments[index].pinned = pinned;
+            m_assignments[index].named = named;
+            return index;
+        }
+
+        /// \brief Marks an assignment released, so its CPU no longer counts as loaded by it.
+        /// \param index Index of the assignment in `assignments()`.
+        void release(std::size_t index) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (index < m_assignments.size()) {
+                m_assignments[index].released = true;
+            }
+        }
+
+        /// \brief Returns every assignment made so far, in order.
+        std::vector<ThreadAssignment> assignments() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_assignments;
+        }
+
+    private:
+        ThreadPlacementPolicy         m_policy;
+        CpuTopology                   m_topology;
+        mutable std::mutex            m_mutex;
+        std::vector<ThreadAssignment> m_assignments;
+
+        /// \brief Appends an assignment with the chosen CPU; the caller holds the mutex.
+        std::size_t reserve(const std::string& name) {
+            ThreadAssignment assignment;
+            assignment.name = name;
+            assignment.cpu = m_policy.enabled() ? choose_cpu() : -1;
+            m_assignments.push_back(assignment);
+            return m_assignments.size() - 1;
+        }
+
+        /// \brief Returns the online CPU with the lowest placement cost, excluding the anchor.
+        int choose_cpu() const {
+            const int anchor = m_topology.find(m_policy.anchor()) ? m_policy.anchor() : -1;
+            int best = -1;
+            long best_cost = 0;
+            for (const CpuInfo& cpu : m_topology.cpus()) {
+                if (cpu.id == anchor) {
+                    continue;
+                }
+                const long cost = cost_of(cpu.id, anchor);
+                if (best < 0 || cost < best_cost) {
+                    best = cpu.id;
+                    best_cost = cost;
+                }
+            }
+            return best;
+        }
+
+        /// \brief Weighs rule violations so that each rule outranks every rule after it
+        /// and all of them outrank load: anchor sibling, node, cache, then CPUs shared
+        /// with threads that are still running.
+        long cost_of(int cpu, int anchor) const {
+            long cost = 0;
+            if (anchor >= 0) {
+                if (m_policy.avoid_smt_sibling() && m_topology.smt_siblings(cpu, anchor)) {
+                    cost += 1000000;
+                }
+                if (m_policy.numa_local() && m_topology.node_of(cpu) != m_topology.node_of(anchor)) {
+                    cost += 100000;
+                }
+                if (m_policy.same_cache() && !m_topology.share_last_level_cache(cpu, anchor)) {
+                    cost += 10000;
+                }
+            }
+            for (const ThreadAssignment& assignment : m_assignments) {
+                if (assignment.released) {
+                    continue;
+                }
+                if (assignment.cpu == cpu) {
+                    cost += 2;
+                } else if (m_policy.avoid_smt_sibling() && m_topology.smt_siblings(cpu, assignment.cpu)) {
+                    cost += 1;
+                }
+            }
+            return cost;
+        }
+    }; // ThreadPlacement
+
+    /// \class PlacedThread
+    /// \brief Releases a thread's assignment when destroyed; keep it until the thread exits.
+    ///
+    /// Refers to the placement weakly, so it does not keep the service alive.
+    class PlacedThread {
+    public:
+        /// \brief Creates a handle that releases nothing.
+        PlacedThread() = default;
+
+        /// \brief Takes over the assignment at `index` of `placement`.
+        PlacedThread(const std::shared_ptr<ThreadPlacement>& placement, std::size_t index) :
+            m_placement(placement), m_index(index) {
+        }
+
+        PlacedThread(PlacedThread&& other) : m_placement(other.m_placement), m_index(other.m_index) {
+            other.m_placement.reset();
+        }
+
+        PlacedThread& operator=(PlacedThread&& other) {
+            if (this != &other) {
+                release();
+                m_placement = other.m_placement;
+                m_index = other.m_index;
+                other.m_placement.reset();
+            }
+            return *this;
+        }
+
+        PlacedThread(const PlacedThread&) = delete;
+        PlacedThread& operator=(const PlacedThread&) = delete;
+
+        ~PlacedThread() {
+            release();
+        }
+
+        /// \brief Releases the assignment now instead of on destruction.
+        void release() {
+            if (std::shared_ptr<ThreadPlacement> placement = m_placement.lock()) {
+                placement->release(m_index);
+            }
+            m_placement.reset();
+        }
+
+    private:
+        std::weak_ptr<ThreadPlacement> m_placement;
+        std::size_t                    m_index{0};
+    }; // PlacedThread
+
+    /// \brief Places the calling thread with `placement`, or only names it when there is none.
+    /// \param placement Placement service looked up when the thread was created; may be null.
+    /// \param name Thread name.
+    /// \return Handle that releases the assignment when the thread drops it.
+    inline PlacedThread place_current_thread(const std::shared_ptr<ThreadPlacement>& placement, const std::string& name) {
+        if (!placement) {
+            set_current_thread_name(name);
+            return PlacedThread();
+        }
+        return PlacedThread(placement, placement->place_current_thread(name));
+    }
+
+} // namespace consolix
+
+#endif // _CONSOLIX_THREAD_PLACEMENT_HPP_INCLUDED
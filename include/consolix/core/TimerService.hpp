@@ -0,0 +1,519 @@
+#pragma once
+#ifndef _CONSOLIX_TIMER_SERVICE_HPP_INCLUDED
+#define _CONSOLIX_TIMER_SERVICE_HPP_INCLUDED
+
+/// \file TimerService.hpp
+/// \brief Hierarchical timing wheel whose callbacks run on the loop thread.
+/// \ingroup Core
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace consolix {
+
+    /// \class TimerService
+    /// \brief One-shot and periodic timers on a four-level hashed timing wheel.
+    ///
+    /// Timers are kept in 4 x 256 slots of intrusive lists: level 0 holds timers due
+    /// within 256 ticks, each higher level covers 256 times the range of the one below
+    /// and is cascaded down when the wheel reaches its slot. Scheduling and cancelling
+    /// are O(1) whatever the number of timers; advancing costs O(1) per tick plus the
+    /// timers that fire or cascade, and empty stretches are skipped via slot bitmaps.
+    ///
+    /// `ConsoleApplicationRunner` registers a `TimerService` in the manager's
+    /// `ServiceLocator`, calls `advance()` before each pass and bounds its wait by
+    /// `next_expiry()`, so callbacks run on the loop thread:
+    ///
+    /// ```cpp
+    /// auto& timers = consolix::get_service<consolix::TimerService>();
+    /// m_heartbeat = timers.schedule_every(std::chrono::seconds(1), [this]() { send_heartbeat(); });
+    /// timers.schedule_after(std::chrono::milliseconds(250), [this]() { retry(); },
+    ///                       std::chrono::milliseconds(50)); // may fire up to 50 ms late
+    /// ```
+    ///
+    /// A non-zero slack lets the service round the expiry up to an aligned tick, so
+    /// timers with nearby deadlines fire in one batch. Scheduling and cancelling are
+    /// thread-safe; callbacks may schedule and cancel timers, including their own.
+    class TimerService {
+    public:
+        typedef std::chrono::steady_clock Clock;
+        /// \brief Timer identifier; `0` never identifies a timer.
+        typedef std::uint64_t TimerId;
+        /// \brief Timer callback.
+        typedef std::function<void()> Callback;
+
+        /// \brief Creates an empty wheel.
+        /// \param resolution Tick length; expiries are rounded up to whole ticks.
+        /// \throws std::invalid_argument If `resolution` is not positive.
+        explicit TimerService(Clock::duration resolution = std::chrono::milliseconds(1)) :
+                m_resolution(resolution),
+                m_origin(Clock::now()) {
+            if (resolution <= Clock::duration::zero()) {
+                throw std::invalid_argument("TimerService: resolution must be positive");
+            }
+            for (std::size_t level = 0; level < level_count; ++level) {
+                m_slots[level].fill(nil);
+                m_occupied[level].fill(0);
+            }
+        }
+
+        TimerService(const TimerService&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+
+        /// \brief Installs a callback run when a new timer expires before the previous earliest one.
+        ///
+        /// The runner uses it to wake the loop so a sleeping wait is shortened.
+        void set_wake_callback(std::function<void()> callback) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wake_callback = std::move(callback);
+        }
+
+        /// \brief Schedules a one-shot timer.
+        /// \param delay Time until the callback runs.
+        /// \param callback Function called on the thread that calls `advance()`.
+        /// \param slack Extra delay the service may add to coalesce timers.
+        /// \return Identifier for `cancel()`.
+        TimerId schedule_after(Clock::duration delay, Callback callback,
+                               Clock::duration slack = Clock::duration::zero()) {
+            return schedule(delay, Clock::duration::zero(), slack, std::move(callback));
+        }
+
+        /// \brief Schedules a periodic timer; the first run is one period from now.
+        /// \param period Interval between runs; must be positive.
+        /// \param callback Function called on the thread that calls `advance()`.
+        /// \param slack Extra delay the service may add to each run to coalesce timers.
+        /// \return Identifier for `cancel()`.
+        /// \throws std::invalid_argument If `period` is not positive.
+        TimerId schedule_every(Clock::duration period, Callback callback,
+                               Clock::duration slack = Clock::duration::zero()) {
+            if (period <= Clock::duration::zero()) {
+                throw std::invalid_argument("TimerService: period must be positive");
+            }
+            return schedule(period, period, slack, std::move(callback));
+        }
+
+        /// \brief Cancels a timer; a periodic timer may cancel itself from its callback.
+        /// \return `true` if the timer was pending or running.
+        bool cancel(TimerId id) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Node* node = find(id);
+            if (!node) {
+                return false;
+            }
+            if (node->state == Node::Pending) {
+                unlink(index_of(id));
+                release(index_of(id));
+            } else {
+                node->state = Node::Cancelled; // Released once its callback returns.
+            }
+            return true;
+        }
+
+        /// \brief Returns the number of scheduled timers.
+        std::size_t size() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_active;
+        }
+
+        /// \brief Returns the latest time by which `advance()` should be called again.
+        ///
+        /// The value is exact for timers due within 256 ticks and otherwise the time of
+        /// the next cascade, which never lies after the real expiry.
+        /// \return `time_point::max()` when no timer is scheduled.
+        Clock::time_point next_expiry() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_active == 0) {
+                return Clock::time_point::max();
+            }
+            return time_of(next_event_tick());
+        }
+
+        /// \brief Runs the callbacks of every timer due at `now`.
+        /// \param now Current time.
+        /// \return Number of callbacks run.
+        std::size_t advance(Clock::time_point now = Clock::now()) {
+            std::vector<std::uint32_t> due;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                const std::uint64_t target = tick_floor(now);
+                if (m_active == 0) {
+                    if (target > m_now) {
+                        m_now = target;
+                    }
+                    return 0;
+                }
+                collect_due(target, due);
+            }
+
+            std::size_t fired = 0;
+            for (std::size_t i = 0; i < due.size(); ++i) {
+                try {
+                    if (run(due[i])) {
+                        ++fired;
+                    }
+                } catch (...) {
+                    requeue(due, i + 1);
+                    throw;
+                }
+            }
+            return fired;
+        }
+
+    private:
+        // Enumerators rather than static members, so passing them by reference
+        // (as `std::array::fill` does) needs no out-of-line definition in C++11.
+        enum : std::size_t { level_count = 4, slot_count = 256 };
+        enum : std::uint32_t { nil = 0xffffffffu };
+
+        struct Node {
+            enum State : std::uint8_t { Free, Pending, Running, Cancelled };
+
+            Callback      callback;
+            std::uint64_t expiry{0};     ///< Tick at which the timer fires.
+            std::uint64_t period{0};     ///< Period in ticks; `0` for one-shot timers.
+            std::uint64_t slack{0};      ///< Slack in ticks.
+            std::uint32_t prev{nil};
+            std::uint32_t next{nil};     ///< Next node in the slot, or next free node.
+            std::uint32_t generation{1}; ///< Bumped on release so stale ids miss.
+            std::uint16_t slot{0};       ///< `level * slot_count + index` while pending.
+            State         state{Free};
+        };
+
+        Clock::duration    m_resolution;
+        Clock::time_point  m_origin;
+        mutable std::mutex m_mutex;
+        std::uint64_t      m_now{0};     ///< Last processed tick.
+        std::size_t        m_active{0};
+        std::vector<Node>  m_nodes;
+        std::uint32_t      m_free{nil};
+        std::array<std::array<std::uint32_t, slot_count>, level_count> m_slots;
+        std::array<std::array<std::uint64_t, slot_count / 64>, level_count> m_occupied;
+        std::function<void()> m_wake_callback;
+
+        TimerId schedule(Clock::duration delay, Clock::duration period, Clock::duration slack, Callback callback) {
+            std::function<void()> wake;
+            TimerId id = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                const Clock::time_point previous = m_active == 0 ? Clock::time_point::max() : time_of(next_event_tick());
+                const std::uint32_t index = acquire();
+                Node& node = m_nodes[index];
+                node.callback = std::move(callback);
+                node.period = period > Clock::duration::zero() ? ticks_ceil(period) : 0;
+                node.slack = slack > Clock::duration::zero() ? ticks_floor(slack) : 0;
+                node.expiry = coalesce(tick_ceil(Clock::now() + (delay > Clock::duration::zero() ? delay : Clock::duration::zero())), node.slack);
+                if (node.expiry <= m_now) {
+                    node.expiry = m_now + 1;
+                }
+                node.state = Node::Pending;
+                link(index);
+                id = make_id(index, node.generation);
+                if (time_of(node.expiry) < previous) {
+                    wake = m_wake_callback;
+                }
+            }
+            if (wake) {
+                wake();
+            }
+            return id;
+        }
+
+        /// \brief Processes ticks up to `target`, moving due nodes into `due`.
+        ///
+        /// Jumps straight to the next level-0 expiry or higher-level cascade, so idle
+        /// stretches cost nothing however long they are.
+        void collect_due(std::uint64_t target, std::vector<std::uint32_t>& due) {
+            while (m_now < target) {
+                const std::uint64_t next = next_event_tick();
+                if (next > target) {
+                    m_now = target;
+                    break;
+                }
+                m_now = next;
+                cascade(m_now);
+                take_slot(0, static_cast<std::size_t>(m_now & (slot_count - 1)), due);
+            }
+        }
+
+        /// \brief Moves higher-level slots reached at `tick` down the wheel.
+        void cascade(std::uint64_t tick) {
+            for (std::size_t level = level_count - 1; level >= 1; --level) {
+                const unsigned shift = static_cast<unsigned>(8 * level);
+                if ((tick & ((std::uint64_t(1) << shift) - 1)) != 0) {
+                    continue;
+                }
+                const std::size_t slot = static_cast<std::size_t>((tick >> shift) & (slot_count - 1));
+                std::uint32_t index = detach_slot(level, slot);
+                while (index != nil) {
+                    const std::uint32_t next = m_nodes[index].next;
+                    link(index);
+                    index = next;
+                }
+            }
+        }
+
+        void take_slot(std::size_t level, std::size_t slot, std::vector<std::uint32_t>& due) {
+            std::uint32_t index = detach_slot(level, slot);
+            while (index != nil) {
+                Node& node = m_nodes[index];
+                const std::uint32_t next = node.next;
+                if (node.expiry <= m_now) {
+                    node.state = Node::Running;
+                    due.push_back(index);
+                } else {
+                    link(index); // Far timer clamped into the top level.
+                }
+                index = next;
+            }
+        }
+
+        /// \brief Runs one due timer outside the lock and reschedules or releases it.
+        bool run(std::uint32_t index) {
+            Callback callback;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                Node& node = m_nodes[index];
+                if (node.state != Node::Running) {
+                    release(index);
+                    return false;
+                }
+                callback.swap(node.callback);
+            }
+
+            try {
+                callback();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                release(index);
+                throw;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Node& node = m_nodes[index];
+            if (node.state == Node::Running && node.period != 0) {
+                node.callback.swap(callback);
+                node.expiry = coalesce(node.expiry + node.period, node.slack);
+                if (node.expiry <= m_now) {
+                    // Behind by more than a period: skip the missed runs.
+                    node.expiry = coalesce(m_now + 1, node.slack);
+                }
+                node.state = Node::Pending;
+                link(index);
+            } else {
+                release(index);
+            }
+            return true;
+        }
+
+        /// \brief Puts due timers not yet run back on the wheel so the next `advance()` fires them.
+        void requeue(const std::vector<std::uint32_t>& due, std::size_t from) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (std::size_t i = from; i < due.size(); ++i) {
+                Node& node = m_nodes[due[i]];
+                if (node.state == Node::Running) {
+                    node.state = Node::Pending;
+                    node.expiry = m_now + 1;
+                    link(due[i]);
+                } else {
+                    release(due[i]);
+                }
+            }
+        }
+
+        void link(std::uint32_t index) {
+            Node& node = m_nodes[index];
+            const std::uint64_t delta = node.expiry > m_now ? node.expiry - m_now : 0;
+            std::size_t level = 0;
+            std::uint64_t position = node.expiry;
+            if (delta >= (std::uint64_t(1) << 24)) {
+                level = 3;
+                const std::uint64_t horizon = m_now + (std::uint64_t(1) << 32) - 1;
+                position = node.expiry < horizon ? node.expiry : horizon;
+            } else if (delta >= (std::uint64_t(1) << 16)) {
+                level = 2;
+            } else if (delta >= slot_count) {
+                level = 1;
+            }
+            const std::size_t slot = static_cast<std::size_t>((position >> (8 * level)) & (slot_count - 1));
+            node.slot = static_cast<std::uint16_t>(level * slot_count + slot);
+            node.prev = nil;
+            node.next = m_slots[level][slot];
+            if (node.next != nil) {
+                m_nodes[node.next].prev = index;
+            }
+            m_slots[level][slot] = index;
+            m_occupied[level][slot / 64] |= std::uint64_t(1) << (slot % 64);
+        }
+
+        void unlink(std::uint32_t index) {
+            Node& node = m_nodes[index];
+            const std::size_t level = node.slot / slot_count;
+            const std::size_t slot = node.slot % slot_count;
+            if (node.prev != nil) {
+                m_nodes[node.prev].next = node.next;
+            } else {
+                m_slots[level][slot] = node.next;
+            }
+            if (node.next != nil) {
+                m_nodes[node.next].prev = node.prev;
+            }
+            if (m_slots[level][slot] == nil) {
+                m_occupied[level][slot / 64] &= ~(std::uint64_t(1) << (slot % 64));
+            }
+        }
+
+        std::uint32_t detach_slot(std::size_t level, std::size_t slot) {
+            const std::uint32_t head = m_slots[level][slot];
+            m_slots[level][slot] = nil;
+            m_occupied[level][slot / 64] &= ~(std::uint64_t(1) << (slot % 64));
+            return head;
+        }
+
+        /// \brief Finds the first occupied slot in `[from, to)` of a level, or `slot_count`.
+        std::size_t next_occupied(std::size_t level, std::size_t from, std::size_t to) const {
+            for (std::size_t word = from / 64; word * 64 < to; ++word) {
+                std::uint64_t bits = m_occupied[level][word];
+                if (word == from / 64) {
+                    bits &= ~std::uint64_t(0) << (from % 64);
+                }
+                if (bits != 0) {
+                    const std::size_t slot = word * 64 + lowest_bit(bits);
+                    return slot < to ? slot : slot_count;
+                }
+            }
+            return slot_count;
+        }
+
+        /// \brief Returns the earliest tick at which `advance()` has work: a level-0
+        /// expiry or the cascade of an occupied higher-level slot. A timer cascaded
+        /// long ago may sit in level 0 behind a newer higher-level one, so every level
+        /// is checked.
+        std::uint64_t next_event_tick() const {
+            std::uint64_t best = std::numeric_limits<std::uint64_t>::max();
+            for (std::size_t level = 0; level < level_count; ++level) {
+                const unsigned shift = static_cast<unsigned>(8 * level);
+                const std::uint64_t position = m_now >> shift;
+                const std::size_t current = static_cast<std::size_t>(position & (slot_count - 1));
+                // Slots after the current one belong to this rotation, the rest to the next.
+                std::size_t slot = next_occupied(level, current + 1, slot_count);
+                std::uint64_t rotation = position & ~std::uint64_t(slot_count - 1);
+                if (slot == slot_count) {
+                    slot = next_occupied(level, 0, current + 1);
+                    rotation += slot_count;
+                }
+                if (slot != slot_count) {
+                    const std::uint64_t tick = (rotation + slot) << shift;
+                    if (tick < best) {
+                        best = tick;
+                    }
+                }
+            }
+            return best;
+        }
+
+        std::uint32_t acquire() {
+            if (m_free != nil) {
+                const std::uint32_t index = m_free;
+                m_free = m_nodes[index].next;
+                ++m_active;
+                return index;
+            }
+            if (m_nodes.size() >= nil) {
+                throw std::length_error("TimerService: too many timers");
+            }
+            m_nodes.push_back(Node());
+            ++m_active;
+            return static_cast<std::uint32_t>(m_nodes.size() - 1);
+        }
+
+        void release(std::uint32_t index) {
+            Node& node = m_nodes[index];
+            node.callback = Callback();
+            node.state = Node::Free;
+            ++node.generation;
+            node.next = m_free;
+            m_free = index;
+            --m_active;
+        }
+
+        Node* find(TimerId id) {
+            const std::uint64_t slot = id & 0xffffffffu;
+            if (slot == 0 || slot > m_nodes.size()) {
+                return nullptr;
+            }
+            Node& node = m_nodes[static_cast<std::size_t>(slot - 1)];
+            if (node.generation != static_cast<std::uint32_t>(id >> 32) || node.state == Node::Free ||
+                node.state == Node::Cancelled) {
+                return nullptr;
+            }
+            return &node;
+        }
+
+        static TimerId make_id(std::uint32_t index, std::uint32_t generation) {
+            return (static_cast<TimerId>(generation) << 32) | (static_cast<TimerId>(index) + 1);
+        }
+
+        static std::uint32_t index_of(TimerId id) {
+            return static_cast<std::uint32_t>((id & 0xffffffffu) - 1);
+        }
+
+        /// \brief Rounds an expiry up to the coarsest power-of-two tick within the slack.
+        static std::uint64_t coalesce(std::uint64_t expiry, std::uint64_t slack) {
+            if (slack == 0) {
+                return expiry;
+            }
+            std::uint64_t align = 1;
+            while (align <= slack / 2) {
+                align <<= 1;
+            }
+            return (expiry + align - 1) & ~(align - 1);
+        }
+
+        static std::size_t lowest_bit(std::uint64_t bits) {
+#           if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctzll(bits));
+#           else
+            std::size_t index = 0;
+            while ((bits & 1) == 0) {
+                bits >>= 1;
+                ++index;
+            }
+            return index;
+#           endif
+        }
+
+        std::uint64_t ticks_floor(Clock::duration duration) const {
+            return static_cast<std::uint64_t>(duration / m_resolution);
+        }
+
+        std::uint64_t ticks_ceil(Clock::duration duration) const {
+            return static_cast<std::uint64_t>((duration + m_resolution - Clock::duration(1)) / m_resolution);
+        }
+
+        std::uint64_t tick_floor(Clock::time_point time) const {
+            return time <= m_origin ? 0 : ticks_floor(time - m_origin);
+        }
+
+        std::uint64_t tick_ceil(Clock::time_point time) const {
+            return time <= m_origin ? 0 : ticks_ceil(time - m_origin);
+        }
+
+        Clock::time_point time_of(std::uint64_t tick) const {
+            const std::uint64_t limit = static_cast<std::uint64_t>(
+                (Clock::time_point::max() - m_origin) / m_resolution);
+            return tick >= limit ? Clock::time_point::max() :
+                m_origin + m_resolution * static_cast<Clock::rep>(tick);
+        }
+    }; // TimerService
+
+} // namespace consolix
+
+#endif // _CONSOLIX_TIMER_SERVICE_HPP_INCLUDED
@@ -101,6 +101,17 @@ namespace consolix {
         }
     }
 
+    /// \brief Wakes loop and initialization waiters of a locator.
+    ///
+    /// Call it when a component becomes ready or new work arrives, so the runner
+    /// re-polls pending components or `LoopThrottleComponent` ends its wait early.
+    /// \param locator Locator whose `LoopWakeService` to wake; the current one by default.
+    inline void wake_loop(ServiceLocator& locator = ServiceLocator::current()) {
+        if (auto service = locator.find_service<LoopWakeService>()) {
+            service->wake_all();
+        }
+    }
+
     /// \brief Stops the application.
     /// Stops the application's main loop and begins the shutdown process.
     inline void stop() {
@@ -5,6 +5,9 @@
 /// \file service_utils.hpp
 /// \brief Utility functions for working with the `ServiceLocator`.
 /// \ingroup Core
+///
+/// The functions operate on `ServiceLocator::current()`: the locator bound to the
+/// calling thread by `ServiceLocator::Scope`, or the global instance otherwise.
 /// ### Example usage of the ServiceLocator.
 /// ```cpp
 /// consolix::register_service<CliOptions>([]() {
@@ -32,7 +35,7 @@ namespace consolix {
     /// \param creator A function to create the resource (optional).
     template <typename T>
     inline void register_service(std::function<std::shared_ptr<T>()> creator) {
-        ServiceLocator::get_instance().register_service<T>(std::move(creator));
+        ServiceLocator::current().register_service<T>(std::move(creator));
     }
 
     /// \brief Registers a resource with default construction globally.
@@ -40,7 +43,34 @@ namespace consolix {
     /// \tparam T The type of the resource.
     template <typename T>
     inline void register_service() {
-        ServiceLocator::get_instance().register_service<T>();
+        ServiceLocator::current().register_service<T>();
+    }
+
+    /// \brief Registers a resource globally that is built on first use.
+    /// \tparam T The type of the resource.
+    /// \param factory A function to create the resource.
+    template <typename T>
+    inline void register_lazy_service(std::function<std::shared_ptr<T>()> factory) {
+        ServiceLocator::current().register_lazy_service<T>(std::move(factory));
+    }
+
+    /// \brief Registers a default-constructed resource globally that is built on first use.
+    /// \tparam T The type of the resource.
+    template <typename T>
+    inline void register_lazy_service() {
+        ServiceLocator::current().register_lazy_service<T>();
+    }
+
+    /// \brief Builds a lazily registered global resource ahead of its first lookup.
+    /// \tparam T The type of the resource.
+    template <typename T>
+    inline void warm_up_service() {
+        ServiceLocator::current().warm_up<T>();
+    }
+
+    /// \brief Builds every lazily registered global resource that is not built yet.
+    inline void warm_up_services() {
+        ServiceLocator::current().warm_up_all();
     }
 
     /// \brief Retrieves a resource globally.
@@ -49,7 +79,7 @@ namespace consolix {
     /// \return Reference to the resource.
     template <typename T>
     inline T& get_service() {
-        return ServiceLocator::get_instance().get_service<T>();
+        return ServiceLocator::current().get_service<T>();
     }
 
     /// \brief Retrieves a shared pointer to a globally registered resource.
@@ -57,7 +87,7 @@ namespace consolix {
     /// \return Shared pointer to the resource.
     template <typename T>
     inline std::shared_ptr<T> get_service_ptr() {
-        return ServiceLocator::get_instance().get_service_ptr<T>();
+        return ServiceLocator::current().get_service_ptr<T>();
     }
 
     /// \brief Attempts to find a globally registered resource.
@@ -65,7 +95,7 @@ namespace consolix {
     /// \return Shared pointer to the resource, or `nullptr` when it is not registered.
     template <typename T>
     inline std::shared_ptr<T> find_service() {
-        return ServiceLocator::get_instance().find_service<T>();
+        return ServiceLocator::current().find_service<T>();
     }
 
     /// \brief Checks if a resource is registered globally.
@@ -73,13 +103,13 @@ namespace consolix {
     /// \return `true` if the resource is registered, `false` otherwise.
     template <typename T>
     inline bool has_service() {
-        return ServiceLocator::get_instance().has_service<T>();
+        return ServiceLocator::current().has_service<T>();
     }
 
     /// \brief Clears all registered resources globally.
     /// Clears all resources and services registered in the `ServiceLocator`
     inline void clear_all() {
-        ServiceLocator::get_instance().clear_all();
+        ServiceLocator::current().clear_all();
     }
 
 }; // namespace consolix
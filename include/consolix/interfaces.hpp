@@ -7,5 +7,10 @@
 
 #include "interfaces/IAppComponent.hpp" ///< Interface for application components.
 #include "interfaces/IShutdownable.hpp" ///< Interface for shutdown-capable components.
+#include "interfaces/IInitDependencies.hpp" ///< Interface for declaring initialization dependencies.
+#include "interfaces/IParallelProcess.hpp" ///< Marker for components that may process in parallel.
+#include "interfaces/IWorkReporter.hpp" ///< Interface for components reporting work per pass.
+#include "interfaces/ISignalSubscriber.hpp" ///< Interface for components reacting to signals.
+#include "interfaces/IComponentManager.hpp" ///< Interface for runner-driven component managers.
 
 #endif // _CONSOLIX_INTERFACES_HPP_INCLUDED
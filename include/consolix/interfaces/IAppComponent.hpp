@@ -15,9 +15,11 @@ namespace consolix {
     /// - `process()`: Repeated execution during the main loop.
     /// - `is_initialized()`: Verifies if the component is ready for execution.
     ///
-    /// Access to lifecycle methods is restricted to the `AppComponentManager` class to ensure controlled execution.
+    /// Access to lifecycle methods is restricted to the component managers to ensure controlled execution.
     class IAppComponent {
         friend class AppComponentManager; ///< Grants access to `AppComponentManager`.
+        template <typename... Components>
+        friend class StaticComponentManager; ///< Grants access to `StaticComponentManager`.
     public:
         /// \brief Virtual destructor for polymorphic usage.
         virtual ~IAppComponent() = default;
@@ -0,0 +1,101 @@
+#pragma once
+#ifndef _CONSOLIX_ICOMPONENT_MANAGER_HPP_INCLUDED
+#define _CONSOLIX_ICOMPONENT_MANAGER_HPP_INCLUDED
+
+/// \file IComponentManager.hpp
+/// \brief Defines the interface for component managers driven by a runner.
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "../core/ComponentStats.hpp"
+
+namespace consolix {
+
+    class ServiceLocator;
+    struct ShutdownReport;
+
+    /// \class IComponentManager
+    /// \brief Interface for managers that drive a set of components through their lifecycle.
+    ///
+    /// `ConsoleApplicationRunner` works with any manager implementing this interface:
+    /// the dynamic `AppComponentManager` or the compile-time `StaticComponentManager`.
+    /// The runner makes one call per lifecycle step; how components are stored and
+    /// dispatched is up to the manager.
+    class IComponentManager {
+    public:
+        /// \brief Virtual destructor for polymorphic usage.
+        virtual ~IComponentManager() = default;
+
+        /// \brief Initializes every component that is not initialized yet.
+        /// \return `true` if all components are initialized, `false` otherwise.
+        virtual bool initialize() = 0;
+
+        /// \brief Checks if all components are initialized.
+        /// \return `true` if all components are initialized, `false` otherwise.
+        virtual bool is_initialized() const = 0;
+
+        /// \brief Runs one processing pass over all components.
+        virtual void process() = 0;
+
+        /// \brief Shuts down components in reverse order.
+        /// \param signal The signal or exit code to pass to components.
+        virtual void shutdown(int signal) = 0;
+
+        /// \brief Returns the earliest time at which another `process()` pass has work.
+        ///
+        /// The runner may wait on `LoopWakeService` until this time instead of
+        /// starting the next pass at once.
+        /// \return `time_point::min()` when the next pass is due immediately.
+        virtual std::chrono::steady_clock::time_point next_deadline() const {
+            return std::chrono::steady_clock::time_point::min();
+        }
+
+        /// \brief Checks whether any managed component implements `IWorkReporter`.
+        /// \return `true` if `last_work_count()` carries information.
+        virtual bool reports_work() const {
+            return false;
+        }
+
+        /// \brief Returns the work reported by components that ran in the last pass.
+        /// \return Sum of `IWorkReporter::last_work_count()` values.
+        virtual std::size_t last_work_count() const {
+            return 0;
+        }
+
+        /// \brief Passes a signal to every component implementing `ISignalSubscriber`.
+        /// \param signal_number Delivered signal number.
+        /// \return Number of components notified.
+        virtual std::size_t dispatch_signal(int signal_number) {
+            (void)signal_number;
+            return 0;
+        }
+
+        /// \brief Returns merged timing statistics per component.
+        /// \return One entry per component, or an empty list when statistics are disabled.
+        virtual std::vector<ComponentStats> component_stats() const {
+            return std::vector<ComponentStats>();
+        }
+
+        /// \brief Returns timings of the last `shutdown()` call.
+        /// \return Pointer to the report, or `nullptr` if the manager keeps none.
+        virtual const ShutdownReport* shutdown_report() const {
+            return nullptr;
+        }
+
+        /// \brief Returns the number of component shutdowns still running after `shutdown()`.
+        /// \return Running shutdowns; while nonzero, the runner leaves services and the logger alive.
+        virtual std::size_t running_shutdown_tasks() const {
+            return 0;
+        }
+
+        /// \brief Returns the locator the manager is bound to.
+        /// \return Reference to the bound locator.
+        virtual ServiceLocator& service_locator() const = 0;
+
+    }; // IComponentManager
+
+} // namespace consolix
+
+#endif // _CONSOLIX_ICOMPONENT_MANAGER_HPP_INCLUDED
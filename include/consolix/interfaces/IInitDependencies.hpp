@@ -0,0 +1,69 @@
+#pragma once
+#ifndef _CONSOLIX_IINIT_DEPENDENCIES_HPP_INCLUDED
+#define _CONSOLIX_IINIT_DEPENDENCIES_HPP_INCLUDED
+
+/// \file IInitDependencies.hpp
+/// \brief Defines the interface for components that declare initialization dependencies.
+
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+namespace consolix {
+
+    /// \brief Builds a list of type indices from a type pack.
+    /// \tparam Types Types to list.
+    /// \return Type indices in pack order.
+    template <typename... Types>
+    inline std::vector<std::type_index> type_indices() {
+        return std::vector<std::type_index>{std::type_index(typeid(Types))...};
+    }
+
+    /// \class IInitDependencies
+    /// \brief Interface for components that can be initialized in parallel with others.
+    ///
+    /// A component implementing this interface states what it needs before its
+    /// `initialize()` may run. When parallel initialization is enabled on
+    /// `AppComponentManager`, such components are initialized concurrently once their
+    /// dependencies are ready. Components that do not implement the interface keep the
+    /// sequential behavior: everything registered before them is initialized first, and
+    /// everything registered after them waits for them.
+    ///
+    /// ```cpp
+    /// class CacheWarmer : public consolix::IAppComponent, public consolix::IInitDependencies {
+    ///     std::vector<std::type_index> required_services() const override {
+    ///         return consolix::type_indices<AppConfig>();
+    ///     }
+    ///     // ...
+    /// };
+    /// ```
+    class IInitDependencies {
+    public:
+        /// \brief Virtual destructor for polymorphic usage.
+        virtual ~IInitDependencies() = default;
+
+        /// \brief Component types that must be initialized before this component.
+        /// \return Dynamic types of the components this one depends on.
+        virtual std::vector<std::type_index> component_dependencies() const {
+            return std::vector<std::type_index>();
+        }
+
+        /// \brief Services that must be provided before this component initializes.
+        ///
+        /// Only services provided by other managed components create an ordering;
+        /// services registered outside the manager are assumed to be available.
+        /// \return Service types this component looks up during initialization.
+        virtual std::vector<std::type_index> required_services() const {
+            return std::vector<std::type_index>();
+        }
+
+        /// \brief Services this component registers during initialization.
+        /// \return Service types this component provides.
+        virtual std::vector<std::type_index> provided_services() const {
+            return std::vector<std::type_index>();
+        }
+    }; // IInitDependencies
+
+} // namespace consolix
+
+#endif // _CONSOLIX_IINIT_DEPENDENCIES_HPP_INCLUDED
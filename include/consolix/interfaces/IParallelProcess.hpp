@@ -0,0 +1,26 @@
+#pragma once
+#ifndef _CONSOLIX_IPARALLEL_PROCESS_HPP_INCLUDED
+#define _CONSOLIX_IPARALLEL_PROCESS_HPP_INCLUDED
+
+/// \file IParallelProcess.hpp
+/// \brief Marker interface for components whose `process()` may run in parallel.
+
+namespace consolix {
+
+    /// \class IParallelProcess
+    /// \brief Marks a component whose `process()` does not depend on its neighbours.
+    ///
+    /// When parallel processing is enabled on `AppComponentManager`, consecutive
+    /// components implementing this interface form one stage whose `process()` calls
+    /// run concurrently and end at a join barrier. A component implementing it must
+    /// not touch state owned by other components of the same stage without its own
+    /// synchronization. Components without the marker run alone, in registration order.
+    class IParallelProcess {
+    public:
+        /// \brief Virtual destructor for polymorphic usage.
+        virtual ~IParallelProcess() = default;
+    }; // IParallelProcess
+
+} // namespace consolix
+
+#endif // _CONSOLIX_IPARALLEL_PROCESS_HPP_INCLUDED
@@ -15,9 +15,11 @@ namespace consolix {
     /// or performing cleanup operations when a termination signal is received.
     /// The callback runs during the application's normal shutdown path rather than
     /// directly from a POSIX signal handler.
-    /// Access to the `shutdown` method is restricted to the `AppComponentManager` class.
+    /// Access to the `shutdown` method is restricted to the component managers.
     class IShutdownable {
         friend class AppComponentManager; ///< Grants access to the `AppComponentManager` class.
+        template <typename... Components>
+        friend class StaticComponentManager; ///< Grants access to `StaticComponentManager`.
 
     public:
         /// \brief Virtual destructor for polymorphic use.
@@ -0,0 +1,29 @@
+#pragma once
+#ifndef _CONSOLIX_ISIGNAL_SUBSCRIBER_HPP_INCLUDED
+#define _CONSOLIX_ISIGNAL_SUBSCRIBER_HPP_INCLUDED
+
+/// \file ISignalSubscriber.hpp
+/// \brief Defines the interface for components that react to non-terminating signals.
+
+namespace consolix {
+
+    /// \class ISignalSubscriber
+    /// \brief Interface for components notified of signals such as `SIGHUP` or `SIGUSR1`.
+    ///
+    /// When the runner reads signals through `SignalFdService`, termination signals stop
+    /// the loop and every other watched signal is passed to the manager's
+    /// `dispatch_signal()`, which calls `on_signal()` on each subscribed component.
+    /// Calls happen on the loop thread between passes, so ordinary C++ code is safe here.
+    class ISignalSubscriber {
+    public:
+        /// \brief Virtual destructor for polymorphic usage.
+        virtual ~ISignalSubscriber() = default;
+
+        /// \brief Handles a delivered signal.
+        /// \param signal_number Signal number, for example `SIGHUP`.
+        virtual void on_signal(int signal_number) = 0;
+    }; // ISignalSubscriber
+
+} // namespace consolix
+
+#endif // _CONSOLIX_ISIGNAL_SUBSCRIBER_HPP_INCLUDED
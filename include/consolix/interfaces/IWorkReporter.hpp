@@ -0,0 +1,31 @@
+#pragma once
+#ifndef _CONSOLIX_IWORK_REPORTER_HPP_INCLUDED
+#define _CONSOLIX_IWORK_REPORTER_HPP_INCLUDED
+
+/// \file IWorkReporter.hpp
+/// \brief Defines the interface for components that report work done per pass.
+
+#include <cstddef>
+
+namespace consolix {
+
+    /// \class IWorkReporter
+    /// \brief Interface for components that report how much work their last `process()` did.
+    ///
+    /// Component managers sum the reports of the components that ran in a pass, and
+    /// `ConsoleApplicationRunner` uses the total to drive its `IdlePolicy`: passes that
+    /// did work keep the loop hot, idle passes back off from spinning to yielding to
+    /// parking on `LoopWakeService`.
+    class IWorkReporter {
+    public:
+        /// \brief Virtual destructor for polymorphic usage.
+        virtual ~IWorkReporter() = default;
+
+        /// \brief Returns work units processed by the last pass.
+        /// \return Number of events, tasks or other items handled; `0` when idle.
+        virtual std::size_t last_work_count() const = 0;
+    }; // IWorkReporter
+
+} // namespace consolix
+
+#endif // _CONSOLIX_IWORK_REPORTER_HPP_INCLUDED
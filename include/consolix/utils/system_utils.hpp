@@ -5,20 +5,31 @@
 /// \file system_utils.hpp
 /// \brief Provides system-related utility functions such as clipboard handling, OS detection, and system information retrieval.
 
+#include <cerrno>
 #include <chrono>
 #include <cstdlib>
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
 #elif defined(__linux__) || defined(__APPLE__)
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/socket.h>
 #include <pwd.h>
 #endif
 
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 namespace consolix {
 
     /// \brief Copies the given text to the system clipboard.
@@ -149,6 +160,231 @@ namespace consolix {
         return value ? std::string(value) : "";
     }
 
+    /// \brief Sends an open file descriptor over a Unix domain socket (`SCM_RIGHTS`).
+    ///
+    /// Used to share a `LoopWakeService` `eventfd` with another process.
+    /// \param socket_fd Connected `AF_UNIX` socket.
+    /// \param fd Descriptor to send; the caller keeps its own copy.
+    /// \return True if the descriptor was sent, false otherwise or on unsupported platforms.
+    inline bool send_file_descriptor(int socket_fd, int fd) {
+#       if defined(__linux__) || defined(__APPLE__)
+        char byte = 0;
+        iovec payload = {};
+        payload.iov_base = &byte;
+        payload.iov_len = 1;
+
+        char control[CMSG_SPACE(sizeof(int))];
+        std::memset(control, 0, sizeof(control));
+        msghdr message = {};
+        message.msg_iov = &payload;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        cmsghdr* header = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SCM_RIGHTS;
+        header->cmsg_len = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(header), &fd, sizeof(int));
+
+        ssize_t sent = 0;
+        do {
+            sent = ::sendmsg(socket_fd, &message, 0);
+        } while (sent < 0 && errno == EINTR);
+        return sent == 1;
+#       else
+        (void)socket_fd;
+        (void)fd;
+        return false;
+#       endif
+    }
+
+    /// \brief Receives a file descriptor sent with `send_file_descriptor()`.
+    /// \param socket_fd Connected `AF_UNIX` socket.
+    /// \return The received descriptor (close-on-exec where supported), or -1 on failure.
+    inline int receive_file_descriptor(int socket_fd) {
+#       if defined(__linux__) || defined(__APPLE__)
+        char byte = 0;
+        iovec payload = {};
+        payload.iov_base = &byte;
+        payload.iov_len = 1;
+
+        char control[CMSG_SPACE(sizeof(int))];
+        std::memset(control, 0, sizeof(control));
+        msghdr message = {};
+        message.msg_iov = &payload;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        int flags = 0;
+#       if defined(MSG_CMSG_CLOEXEC)
+        flags |= MSG_CMSG_CLOEXEC;
+#       endif
+        ssize_t received = 0;
+        do {
+            received = ::recvmsg(socket_fd, &message, flags);
+        } while (received < 0 && errno == EINTR);
+        if (received <= 0) {
+            return -1;
+        }
+
+        for (cmsghdr* header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header)) {
+            if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS &&
+                header->cmsg_len >= CMSG_LEN(sizeof(int))) {
+                int fd = -1;
+                std::memcpy(&fd, CMSG_DATA(header), sizeof(int));
+                return fd;
+            }
+        }
+        return -1;
+#       else
+        (void)socket_fd;
+        return -1;
+#       endif
+    }
+
+    /// \brief Pins the calling thread to one logical CPU for the rest of its life.
+    ///
+    /// Supported on Linux and Windows (CPUs 0-63); see `ScopedCpuPin` for a scoped pin.
+    /// \param cpu Logical CPU index.
+    /// \return `true` if the thread is pinned.
+    inline bool pin_current_thread(int cpu) {
+#       if defined(__linux__)
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+            return false;
+        }
+        cpu_set_t target;
+        CPU_ZERO(&target);
+        CPU_SET(cpu, &target);
+        return ::sched_setaffinity(0, sizeof(target), &target) == 0;
+#       elif defined(_WIN32)
+        if (cpu < 0 || cpu >= 64) {
+            return false;
+        }
+        return ::SetThreadAffinityMask(::GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu) != 0;
+#       else
+        (void)cpu;
+        return false;
+#       endif
+    }
+
+    /// \brief Names the calling thread for debuggers, `top -H` and `/proc/<pid>/task`.
+    ///
+    /// Supported on Linux, where names are truncated to 15 characters, and macOS.
+    /// \param name Thread name.
+    /// \return `true` if the name was set.
+    inline bool set_current_thread_name(const std::string& name) {
+#       if defined(__linux__)
+        const std::string truncated = name.substr(0, 15);
+        return ::pthread_setname_np(::pthread_self(), truncated.c_str()) == 0;
+#       elif defined(__APPLE__)
+        return ::pthread_setname_np(name.c_str()) == 0;
+#       else
+        (void)name;
+        return false;
+#       endif
+    }
+
+    /// \class ScopedCpuPin
+    /// \brief Pins the current thread to one logical CPU, or a set of them, and restores
+    /// its affinity on scope exit.
+    ///
+    /// Supported on Linux (`sched_setaffinity`) and Windows (`SetThreadAffinityMask`,
+    /// CPUs 0-63). Elsewhere, or for a negative or unavailable CPU, `pinned()` is false
+    /// and the affinity is left unchanged.
+    class ScopedCpuPin {
+    public:
+        /// \brief Restricts the calling thread to those of `cpus` it may already run on.
+        /// \param cpus Logical CPU indices. When none of them is in the current
+        ///             affinity, the affinity is left unchanged.
+        explicit ScopedCpuPin(const std::vector<int>& cpus) {
+#           if defined(__linux__)
+            if (::sched_getaffinity(0, sizeof(m_previous), &m_previous) != 0) {
+                return;
+            }
+            cpu_set_t target;
+            CPU_ZERO(&target);
+            for (int cpu : cpus) {
+                if (cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &m_previous)) {
+                    CPU_SET(cpu, &target);
+                }
+            }
+            m_pinned = CPU_COUNT(&target) != 0 && ::sched_setaffinity(0, sizeof(target), &target) == 0;
+#           elif defined(_WIN32)
+            DWORD_PTR process_mask = 0;
+            DWORD_PTR system_mask = 0;
+            if (!::GetProcessAffinityMask(::GetCurrentProcess(), &process_mask, &system_mask)) {
+                return;
+            }
+            DWORD_PTR target = 0;
+            for (int cpu : cpus) {
+                if (cpu >= 0 && cpu < 64) {
+                    target |= static_cast<DWORD_PTR>(1) << cpu;
+                }
+            }
+            target &= process_mask;
+            if (target == 0) {
+                return;
+            }
+            m_previous = ::SetThreadAffinityMask(::GetCurrentThread(), target);
+            m_pinned = m_previous != 0;
+#           else
+            (void)cpus;
+#           endif
+        }
+
+        /// \brief Pins the calling thread.
+        /// \param cpu Logical CPU index; negative values leave the affinity unchanged.
+        explicit ScopedCpuPin(int cpu) {
+#           if defined(__linux__)
+            if (cpu < 0 || cpu >= CPU_SETSIZE || ::sched_getaffinity(0, sizeof(m_previous), &m_previous) != 0) {
+                return;
+            }
+            cpu_set_t target;
+            CPU_ZERO(&target);
+            CPU_SET(cpu, &target);
+            m_pinned = ::sched_setaffinity(0, sizeof(target), &target) == 0;
+#           elif defined(_WIN32)
+            if (cpu < 0 || cpu >= 64) {
+                return;
+            }
+            m_previous = ::SetThreadAffinityMask(::GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu);
+            m_pinned = m_previous != 0;
+#           else
+            (void)cpu;
+#           endif
+        }
+
+        /// \brief Restores the affinity the thread had before pinning.
+        ~ScopedCpuPin() {
+            if (!m_pinned) {
+                return;
+            }
+#           if defined(__linux__)
+            ::sched_setaffinity(0, sizeof(m_previous), &m_previous);
+#           elif defined(_WIN32)
+            ::SetThreadAffinityMask(::GetCurrentThread(), m_previous);
+#           endif
+        }
+
+        ScopedCpuPin(const ScopedCpuPin&) = delete;
+        ScopedCpuPin& operator=(const ScopedCpuPin&) = delete;
+
+        /// \brief Returns whether the thread is pinned.
+        bool pinned() const {
+            return m_pinned;
+        }
+
+    private:
+        bool m_pinned{false};
+#       if defined(__linux__)
+        cpu_set_t m_previous;
+#       elif defined(_WIN32)
+        DWORD_PTR m_previous{0};
+#       endif
+    }; // ScopedCpuPin
+
 }; // namespace consolix
 
 #endif // _CONSOLIX_SYSTEM_UTILS_HPP_INCLUDED
@@ -0,0 +1,106 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class QueueComponent final :
+        public consolix::IAppComponent,
+        public consolix::IWorkReporter {
+public:
+    std::atomic<int> queued{0};
+    std::atomic<int> handled{0};
+    std::atomic<long long> calls{0};
+    std::atomic<int> timer_runs{0};
+
+    std::size_t last_work_count() const override {
+        return m_last_work_count;
+    }
+
+protected:
+    bool initialize() override {
+        consolix::get_service<consolix::TimerService>().schedule_every(
+            std::chrono::milliseconds(10), [this]() { ++timer_runs; });
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+        ++calls;
+        const int work = queued.exchange(0);
+        handled += work;
+        m_last_work_count = static_cast<std::size_t>(work);
+    }
+
+private:
+    std::size_t m_last_work_count{0};
+    bool        m_initialized{false};
+};
+
+void run_busy_poll_scenario(int cpu, std::uint32_t yield_every) {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto component = manager.add<QueueComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    runner.enable_busy_poll(cpu, yield_every);
+    expect(runner.busy_poll_enabled(), "busy-poll mode must be reported");
+
+    std::atomic<bool> live_report(false);
+    std::thread controller([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        component->queued = 7;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        live_report = runner.busy_poll_report().iterations > 0;
+        runner.request_stop(0);
+    });
+
+    const auto started = std::chrono::steady_clock::now();
+    const int exit_code = runner.run_for_exit_code();
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+    controller.join();
+
+    const consolix::BusyPollReport report = runner.busy_poll_report();
+    expect(exit_code == 0, "busy-poll runner must stop normally");
+    expect(elapsed < std::chrono::seconds(2), "stop must end the busy-poll loop promptly");
+    expect(component->handled == 7, "busy-poll passes must process work");
+    expect(component->timer_runs >= 5, "timers must fire in busy-poll mode");
+    expect(live_report.load(), "the report must be readable during the run");
+    expect(report.iterations >= 1000, "busy-poll mode must run passes back to back");
+    expect(report.gaps.count() + 1 == report.iterations, "every gap between passes must be recorded");
+    expect(report.gaps.percentile(0.5) <= report.gaps.percentile(0.999), "gap percentiles must be ordered");
+    expect(report.cpu == cpu, "the requested core must be reported");
+    if (cpu < 0) {
+        expect(!report.pinned, "no pinning must be reported without a core");
+    }
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_busy_poll_scenario(-1, 0);
+        run_busy_poll_scenario(0, 64);
+
+        std::cout << "Busy-poll checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Busy-poll test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,123 @@
+#define CONSOLIX_INIT_POLL_INTERVAL_MS 2000
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class ReadyComponent final : public consolix::IAppComponent {
+public:
+    mutable int ready_checks = 0;
+
+protected:
+    bool initialize() override {
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        ++ready_checks;
+        return m_initialized;
+    }
+
+    void process() override {
+    }
+
+private:
+    bool m_initialized{false};
+};
+
+class DelayedComponent final : public consolix::IAppComponent {
+public:
+    std::atomic<bool> ready{false};
+    int               attempts = 0;
+
+protected:
+    bool initialize() override {
+        ++attempts;
+        return ready.load();
+    }
+
+    bool is_initialized() const override {
+        return ready.load();
+    }
+
+    void process() override {
+        consolix::ConsoleApplicationRunner::request_current_stop(0);
+    }
+};
+
+void run_pending_only_scenario() {
+    consolix::AppComponentManager manager;
+    auto ready = manager.add<ReadyComponent>();
+    auto delayed = manager.add<DelayedComponent>();
+
+    expect(!manager.initialize(), "dynamic manager must report pending components");
+    const int checks_after_first_pass = ready->ready_checks;
+    expect(!manager.initialize(), "dynamic manager must keep reporting pending components");
+    expect(!manager.is_initialized(), "dynamic manager must not be initialized yet");
+    expect(ready->ready_checks == checks_after_first_pass,
+           "dynamic manager must not re-poll ready components");
+
+    delayed->ready.store(true);
+    expect(manager.initialize(), "dynamic manager must finish once the component is ready");
+    expect(delayed->attempts == 2, "dynamic manager must skip initialize for ready components");
+
+    consolix::StaticComponentManager<ReadyComponent, DelayedComponent> static_manager;
+    expect(!static_manager.initialize(), "static manager must report pending components");
+    const int static_checks = static_manager.get<ReadyComponent>().ready_checks;
+    expect(!static_manager.initialize(), "static manager must keep reporting pending components");
+    expect(static_manager.get<ReadyComponent>().ready_checks == static_checks,
+           "static manager must not re-poll ready components");
+    static_manager.get<DelayedComponent>().ready.store(true);
+    expect(static_manager.initialize(), "static manager must finish once the component is ready");
+}
+
+void run_wake_on_ready_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto delayed = manager.add<DelayedComponent>();
+
+    std::thread notifier([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        delayed->ready.store(true);
+        consolix::wake_loop(locator);
+    });
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    const auto start = std::chrono::steady_clock::now();
+    const int exit_code = runner.run_for_exit_code();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    notifier.join();
+
+    expect(exit_code == 0, "runner must finish normally");
+    expect(elapsed < std::chrono::milliseconds(1000),
+           "readiness notification must wake the runner before the poll interval");
+    expect(delayed->attempts == 1, "runner must not initialize a component again once it is ready");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_pending_only_scenario();
+        run_wake_on_ready_scenario();
+
+        std::cout << "Component readiness checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Component readiness test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
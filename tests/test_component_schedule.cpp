@@ -0,0 +1,158 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class CountingComponent final : public consolix::IAppComponent {
+public:
+    std::atomic<int> calls{0};
+
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {
+        ++calls;
+    }
+};
+
+void run_iteration_schedule_scenario() {
+    consolix::AppComponentManager manager;
+    auto every_pass = manager.add<CountingComponent>();
+    auto every_third = manager.add<CountingComponent>();
+    manager.set_schedule(every_third, consolix::ComponentSchedule::every_n_iterations(3));
+
+    for (int i = 0; i < 10; ++i) {
+        manager.process();
+    }
+
+    expect(every_pass->calls == 10, "default schedule must run on every pass");
+    expect(every_third->calls == 4, "iteration schedule must run on passes 0, 3, 6 and 9");
+    expect(manager.next_deadline() == std::chrono::steady_clock::time_point::min(),
+           "every-pass components must keep the next pass due");
+
+    bool threw = false;
+    try {
+        manager.set_schedule(std::make_shared<CountingComponent>(), consolix::ComponentSchedule::on_wake());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    expect(threw, "set_schedule must reject unknown components");
+}
+
+void run_period_schedule_scenario() {
+    consolix::AppComponentManager manager;
+    auto periodic = manager.add<CountingComponent>();
+    manager.set_schedule(periodic, consolix::ComponentSchedule::every(std::chrono::milliseconds(50)));
+
+    manager.process();
+    manager.process();
+    expect(periodic->calls == 1, "period schedule must skip passes before the period elapses");
+
+    const auto deadline = manager.next_deadline();
+    const auto now = std::chrono::steady_clock::now();
+    expect(deadline > now && deadline <= now + std::chrono::milliseconds(50),
+           "next deadline must point at the next period");
+
+    std::this_thread::sleep_until(deadline);
+    manager.process();
+    expect(periodic->calls == 2, "period schedule must run once the deadline passes");
+}
+
+void run_runner_sleeps_until_deadline_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto periodic = manager.add<CountingComponent>();
+    auto woken = manager.add<CountingComponent>();
+    manager.set_schedule(periodic, consolix::ComponentSchedule::every(std::chrono::milliseconds(20)));
+    manager.set_schedule(woken, consolix::ComponentSchedule::on_wake());
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    std::atomic<int> passes(0);
+    std::thread controller([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        consolix::wake_loop(locator);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        runner.request_stop(0);
+    });
+
+    const int exit_code = runner.run_for_exit_code([&passes]() {
+        ++passes;
+    });
+    controller.join();
+
+    expect(exit_code == 0, "scheduled runner must stop normally");
+    expect(periodic->calls >= 5 && periodic->calls <= 12, "period component must run about every 20 ms");
+    expect(woken->calls >= 2 && woken->calls <= 3, "on-wake component must run on the first pass and after wake requests");
+    expect(passes.load() < 40, "runner must sleep until the next deadline instead of spinning");
+}
+
+void run_on_wake_without_service_scenario() {
+    consolix::AppComponentManager manager;
+    auto woken = manager.add<CountingComponent>();
+    manager.set_schedule(woken, consolix::ComponentSchedule::on_wake());
+    expect(manager.next_deadline() == std::chrono::steady_clock::time_point::min(),
+           "an on-wake component must keep its first pass due");
+
+    manager.process();
+    manager.process();
+    manager.process();
+    expect(woken->calls == 1, "without a wake service an on-wake component must run on the first pass only");
+    expect(manager.next_deadline() == std::chrono::steady_clock::time_point::max(),
+           "after its first pass an on-wake component must wait for a wake");
+}
+
+void run_on_wake_seeded_scenario() {
+    consolix::ServiceLocator locator;
+    locator.register_service<consolix::LoopWakeService>();
+    consolix::wake_loop(locator);
+    consolix::wake_loop(locator);
+
+    consolix::AppComponentManager manager(locator);
+    auto woken = manager.add<CountingComponent>();
+    manager.set_schedule(woken, consolix::ComponentSchedule::on_wake());
+
+    manager.process();
+    manager.process();
+    expect(woken->calls == 1, "wakes before the schedule is set must count as one first pass");
+
+    consolix::wake_loop(locator);
+    manager.process();
+    manager.process();
+    expect(woken->calls == 2, "a wake must run the on-wake component once");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_iteration_schedule_scenario();
+        run_period_schedule_scenario();
+        run_runner_sleeps_until_deadline_scenario();
+        run_on_wake_without_service_scenario();
+        run_on_wake_seeded_scenario();
+
+        std::cout << "Component schedule checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Component schedule test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,106 @@
+#define CONSOLIX_COMPONENT_STATS 1
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class SleepingComponent :
+        public consolix::IAppComponent,
+        public consolix::IParallelProcess {
+public:
+    explicit SleepingComponent(int delay_us) :
+        m_delay_us(delay_us) {
+    }
+
+protected:
+    bool initialize() override {
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+        std::this_thread::sleep_for(std::chrono::microseconds(m_delay_us));
+    }
+
+private:
+    int  m_delay_us;
+    bool m_initialized{false};
+};
+
+void run_histogram_scenario() {
+    typedef consolix::LatencyHistogram Histogram;
+    for (std::uint64_t value : {0ull, 7ull, 8ull, 15ull, 16ull, 1000ull, 123456789ull}) {
+        const std::size_t index = Histogram::bucket_index(value);
+        expect(Histogram::bucket_lower_bound(index) <= value && value <= Histogram::bucket_upper_bound(index),
+               "a value must fall inside its bucket bounds");
+    }
+    expect(Histogram::bucket_index(~0ull) == Histogram::bucket_count - 1, "huge values must use the last bucket");
+
+    Histogram first;
+    Histogram second;
+    for (int i = 1; i <= 90; ++i) first.record(1000);
+    for (int i = 1; i <= 10; ++i) second.record(100000);
+    first.merge(second);
+
+    expect(first.count() == 100, "merge must add counts");
+    expect(first.min() == 1000 && first.max() == 100000, "merge must combine extremes");
+    expect(first.percentile(0.5) >= 1000 && first.percentile(0.5) < 1200, "p50 must stay within one bucket");
+    expect(first.percentile(0.99) == 100000, "p99 must be clamped to the maximum");
+
+    first.reset();
+    expect(first.count() == 0 && first.percentile(0.5) == 0, "reset must clear samples");
+}
+
+void run_manager_scenario(std::size_t threads) {
+    consolix::AppComponentManager manager;
+    manager.set_processing_threads(threads);
+    manager.add<SleepingComponent>(0);
+    manager.add<SleepingComponent>(2000);
+    manager.initialize();
+    for (int i = 0; i < 20; ++i) {
+        manager.process();
+    }
+
+    const std::vector<consolix::ComponentStats> stats = manager.component_stats();
+    expect(stats.size() == 2, "stats must have one entry per component");
+    expect(stats[0].process.count() == 20 && stats[1].process.count() == 20,
+           "every process() call must be counted across threads");
+    expect(stats[0].initialize.count() == 1, "initialize() calls must be timed");
+    expect(stats[1].process.percentile(0.5) >= 2000000, "durations must be recorded in nanoseconds");
+    expect(stats[0].process.percentile(0.5) < stats[1].process.percentile(0.5),
+           "stats must tell a slow component from a fast one");
+
+    manager.reset_component_stats();
+    expect(manager.component_stats()[1].process.count() == 0, "reset must clear every shard");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_histogram_scenario();
+        run_manager_scenario(1);
+        run_manager_scenario(3);
+
+        std::cout << "Component stats checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Component stats test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -29,6 +29,10 @@ struct CountingService {
     int* destroyed_count;
 };
 
+struct ShardService {
+    int processed = 0;
+};
+
 void expect(bool condition, const char* message) {
     if (!condition) {
         throw std::runtime_error(message);
@@ -255,6 +259,36 @@ private:
     std::thread    m_stop_thread;
 };
 
+class ShardComponent final : public consolix::IAppComponent {
+public:
+    explicit ShardComponent(std::atomic<int>& processed) :
+        m_processed(processed) {
+    }
+
+protected:
+    bool initialize() override {
+        consolix::register_service<ShardService>();
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+        if (m_service->processed++ == 0) {
+            ++m_processed;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+private:
+    std::atomic<int>&                m_processed;
+    consolix::ServiceRef<ShardService> m_service;
+    bool                             m_initialized{false};
+};
+
 void run_normal_stop_scenario() {
     ScenarioState state;
     int service_destroyed = 0;
@@ -424,6 +458,53 @@ void run_stop_wakes_throttle_scenario() {
     expect(state.shutdown_code == 77, "thread stop must pass code to shutdown");
 }
 
+void run_sharded_runners_scenario() {
+    int service_destroyed = 0;
+    consolix::ServiceLocator::get_instance().register_service<CountingService>(
+        [&service_destroyed]() {
+            return std::make_shared<CountingService>(service_destroyed);
+        });
+
+    std::atomic<int> processed(0);
+    consolix::ServiceLocator first_locator(consolix::ServiceLocator::get_instance());
+    consolix::ServiceLocator second_locator(consolix::ServiceLocator::get_instance());
+    consolix::AppComponentManager first_manager(first_locator);
+    consolix::AppComponentManager second_manager(second_locator);
+    first_manager.add<ShardComponent>(processed);
+    second_manager.add<ShardComponent>(processed);
+
+    consolix::ConsoleApplicationRunner first_runner(first_manager);
+    consolix::ConsoleApplicationRunner second_runner(second_manager);
+    int first_exit_code = -1;
+    int second_exit_code = -1;
+    std::thread first_thread([&]() {
+        first_exit_code = first_runner.run_for_exit_code();
+    });
+    std::thread second_thread([&]() {
+        second_exit_code = second_runner.run_for_exit_code();
+    });
+
+    while (processed.load() < 2) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    expect(first_locator.has_service<ShardService>() && second_locator.has_service<ShardService>(),
+           "each shard must register its services in its own locator");
+    expect(!consolix::ServiceLocator::get_instance().has_service<ShardService>(),
+           "shard services must not leak into the global locator");
+
+    first_runner.request_stop(3);
+    second_runner.request_stop(4);
+    first_thread.join();
+    second_thread.join();
+
+    expect(first_exit_code == 3 && second_exit_code == 4, "each shard must return its own exit code");
+    expect(!first_locator.has_service<ShardService>(), "shard cleanup must clear its locator");
+    expect(consolix::ServiceLocator::get_instance().has_service<CountingService>(),
+           "shard cleanup must not clear the global locator");
+    consolix::ServiceLocator::get_instance().clear_all();
+    expect(service_destroyed == 1, "global services must be cleared once");
+}
+
 } // namespace
 
 int main() {
@@ -436,6 +517,7 @@ int main() {
         run_forced_stop_scenario();
         run_forced_stop_timeout_scenario();
         run_stop_wakes_throttle_scenario();
+        run_sharded_runners_scenario();
 
         std::cout << "ConsoleApplicationRunner checks passed." << std::endl;
         return 0;
@@ -0,0 +1,189 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+template <typename Predicate>
+bool wait_until(Predicate predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+class FeatureComponent final :
+        public consolix::IAppComponent,
+        public consolix::IShutdownable {
+public:
+    explicit FeatureComponent(int init_attempts = 1, int throw_on_attempt = 0) :
+        m_init_attempts(init_attempts),
+        m_throw_on_attempt(throw_on_attempt) {
+    }
+
+    std::atomic<int>  initialize_calls{0};
+    std::atomic<int>  process_calls{0};
+    std::atomic<int>  shutdown_calls{0};
+    std::atomic<bool> processed_before_ready{false};
+
+protected:
+    bool initialize() override {
+        if (++initialize_calls == m_throw_on_attempt) {
+            throw std::runtime_error("feature failed to load");
+        }
+        return initialize_calls.load() >= m_init_attempts;
+    }
+
+    bool is_initialized() const override {
+        return initialize_calls.load() >= m_init_attempts;
+    }
+
+    void process() override {
+        if (!is_initialized()) {
+            processed_before_ready = true;
+        }
+        ++process_calls;
+    }
+
+    void shutdown(int) override {
+        ++shutdown_calls;
+    }
+
+private:
+    int m_init_attempts;
+    int m_throw_on_attempt; ///< 1-based `initialize()` call that throws, or `0` for none.
+};
+
+void run_running_loop_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto base = manager.add<FeatureComponent>();
+    consolix::ConsoleApplicationRunner runner(manager);
+
+    std::string failure;
+    std::thread controller([&]() {
+        try {
+            expect(wait_until([&]() { return base->process_calls.load() > 0; }), "loop must start");
+
+            auto feature = manager.add_deferred<FeatureComponent>(3);
+            auto broken = manager.add_deferred<FeatureComponent>(1, 1);
+            expect(wait_until([&]() { return feature->process_calls.load() > 10; }),
+                   "deferred component must join the running loop");
+            expect(feature->initialize_calls.load() == 3, "deferred component must be initialized until ready");
+            expect(!feature->processed_before_ready, "components must not run before they are ready");
+
+            manager.remove_deferred(feature);
+            expect(wait_until([&]() { return feature->shutdown_calls.load() == 1; }),
+                   "removed component must be shut down");
+            const int calls_after_removal = feature->process_calls.load();
+            const int base_calls = base->process_calls.load();
+            expect(wait_until([&]() { return base->process_calls.load() > base_calls + 10; }),
+                   "loop must keep running after a removal");
+            expect(feature->process_calls.load() == calls_after_removal, "removed component must not run again");
+            expect(broken->process_calls.load() == 0, "components failing to initialize must be discarded");
+
+            auto cancelled = manager.add_deferred<FeatureComponent>();
+            manager.remove_deferred(cancelled);
+            const int base_before_cancel = base->process_calls.load();
+            expect(wait_until([&]() { return base->process_calls.load() > base_before_cancel + 10; }),
+                   "loop must apply cancelled additions");
+            expect(cancelled->initialize_calls.load() == 0 && cancelled->process_calls.load() == 0,
+                   "an add followed by a remove before the next pass must cancel out");
+        } catch (const std::exception& e) {
+            failure = e.what();
+        }
+        runner.request_stop(0);
+    });
+
+    const int exit_code = runner.run_for_exit_code();
+    controller.join();
+
+    expect(failure.empty(), failure.c_str());
+    expect(exit_code == 0, "runner must stop normally");
+    expect(base->shutdown_calls.load() == 1, "remaining components must be shut down with the manager");
+}
+
+void run_remove_before_ready_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    manager.add<FeatureComponent>();
+    manager.initialize();
+
+    auto loading = manager.add_deferred<FeatureComponent>(5);
+    manager.process();
+    expect(loading->initialize_calls.load() == 1, "a deferred component must start initializing on the next pass");
+    manager.remove_deferred(loading);
+    manager.process();
+    expect(loading->shutdown_calls.load() == 1, "a component removed while initializing must be shut down");
+    manager.process();
+    expect(loading->initialize_calls.load() == 1 && loading->process_calls.load() == 0,
+           "a removed component must not be initialized or run again");
+}
+
+void run_failed_retry_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    manager.add<FeatureComponent>();
+    manager.initialize();
+
+    auto failing = manager.add_deferred<FeatureComponent>(5, 2);
+    manager.process();
+    expect(failing->initialize_calls.load() == 1 && failing->shutdown_calls.load() == 0,
+           "a deferred component must stay queued while initializing");
+    manager.process();
+    expect(failing->shutdown_calls.load() == 1, "a started component that throws on a retry must be shut down");
+    manager.process();
+    expect(failing->initialize_calls.load() == 2 && failing->process_calls.load() == 0,
+           "a discarded component must not be initialized or run again");
+}
+
+void run_shutdown_before_ready_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto base = manager.add<FeatureComponent>();
+    manager.initialize();
+
+    auto loading = manager.add_deferred<FeatureComponent>(5);
+    manager.process();
+    auto queued = manager.add_deferred<FeatureComponent>();
+    manager.shutdown(0);
+    expect(base->shutdown_calls.load() == 1, "managed components must be shut down");
+    expect(loading->shutdown_calls.load() == 1, "shutdown must reach components still initializing");
+    expect(queued->shutdown_calls.load() == 0, "queued additions never initialized must not be shut down");
+
+    manager.process();
+    expect(queued->initialize_calls.load() == 0 && loading->initialize_calls.load() == 1,
+           "shutdown must drop queued and initializing deferred components");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_running_loop_scenario();
+        run_remove_before_ready_scenario();
+        run_failed_retry_scenario();
+        run_shutdown_before_ready_scenario();
+
+        std::cout << "Deferred component checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Deferred component test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,163 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class QueueComponent final :
+        public consolix::IAppComponent,
+        public consolix::IWorkReporter {
+public:
+    std::atomic<int>    queued{0};
+    std::atomic<int>    handled{0};
+    std::atomic<int>    calls{0};
+
+    std::size_t last_work_count() const override {
+        return m_last_work_count;
+    }
+
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {
+        ++calls;
+        const int work = queued.exchange(0);
+        handled += work;
+        m_last_work_count = static_cast<std::size_t>(work);
+    }
+
+private:
+    std::size_t m_last_work_count{0};
+};
+
+class SilentComponent final : public consolix::IAppComponent {
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {}
+};
+
+void run_work_aggregation_scenario() {
+    consolix::AppComponentManager silent_manager;
+    silent_manager.add<SilentComponent>();
+    expect(!silent_manager.reports_work(), "managers without reporters must not report work");
+
+    consolix::AppComponentManager manager;
+    auto every_pass = manager.add<QueueComponent>();
+    auto every_second = manager.add<QueueComponent>();
+    manager.add<SilentComponent>();
+    manager.set_schedule(every_second, consolix::ComponentSchedule::every_n_iterations(2));
+    expect(manager.reports_work(), "managers with reporters must report work");
+
+    every_pass->queued = 2;
+    every_second->queued = 3;
+    manager.process();
+    expect(manager.last_work_count() == 5, "work of all reporters that ran must be summed");
+
+    every_pass->queued = 1;
+    manager.process();
+    expect(manager.last_work_count() == 1, "reporters skipped by their schedule must not contribute");
+
+    consolix::StaticComponentManager<QueueComponent, SilentComponent> static_manager;
+    expect(static_manager.reports_work(), "static managers must detect reporter types");
+    static_manager.get<QueueComponent>().queued = 4;
+    static_manager.process();
+    expect(static_manager.last_work_count() == 4, "static managers must sum reporter work");
+}
+
+void run_idle_backoff_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto queue = manager.add<QueueComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    runner.set_idle_policy(consolix::IdlePolicy::low_cpu());
+
+    std::atomic<int> calls_before_wake(-1);
+    std::atomic<long long> wake_latency_us(-1);
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        calls_before_wake = queue->calls.load();
+
+        const auto start = std::chrono::steady_clock::now();
+        queue->queued = 1;
+        consolix::wake_loop(locator);
+        while (queue->handled.load() == 0 &&
+               std::chrono::steady_clock::now() - start < std::chrono::seconds(2)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        wake_latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        runner.request_stop(0);
+    });
+
+    const int exit_code = runner.run_for_exit_code();
+    producer.join();
+
+    expect(exit_code == 0, "idle runner must stop normally");
+    expect(calls_before_wake.load() > 0 && calls_before_wake.load() < 40,
+           "idle runner must park instead of spinning");
+    expect(queue->handled.load() == 1, "queued work must be handled");
+    expect(wake_latency_us.load() >= 0 && wake_latency_us.load() < 50000,
+           "wake requests must end a park early");
+}
+
+void run_spin_window_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto queue = manager.add<QueueComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    runner.set_idle_policy(consolix::IdlePolicy::adaptive(
+        std::chrono::microseconds(20000),
+        std::chrono::microseconds(0),
+        std::chrono::microseconds(10000)));
+
+    std::thread controller([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        runner.request_stop(0);
+    });
+    runner.run_for_exit_code();
+    controller.join();
+
+    expect(queue->calls.load() > 100, "runner must keep spinning during the spin window");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_work_aggregation_scenario();
+        run_idle_backoff_scenario();
+        run_spin_window_scenario();
+
+        std::cout << "Idle policy checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Idle policy test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
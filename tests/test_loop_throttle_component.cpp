@@ -70,6 +70,100 @@ void run_set_delay_scenario() {
            "LoopThrottleComponent zero delay should not wait");
 }
 
+void run_fixed_rate_scenario() {
+    consolix::AppComponentManager manager;
+    auto throttle = manager.add<consolix::LoopThrottleComponent>(
+        std::chrono::milliseconds(1000));
+
+    expect(manager.initialize(), "LoopThrottleComponent did not initialize");
+    throttle->set_fixed_rate(std::chrono::milliseconds(5));
+    expect(throttle->fixed_rate() == std::chrono::milliseconds(5), "fixed rate must be reported");
+    manager.process(); // Consumes the wake from set_fixed_rate() and starts the grid.
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 40; ++i) {
+        manager.process();
+        // Work shorter than the period must not stretch it.
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    const long long elapsed = elapsed_ms(start);
+    const consolix::LoopThrottleComponent::TickStats stats = throttle->tick_stats();
+    expect(stats.ticks == 40, "every pass must release one tick");
+    expect(elapsed >= 190 && elapsed < 400, "fixed-rate ticks must not accumulate work time");
+    expect(stats.lateness.count() == 40, "every tick must record its lateness");
+}
+
+consolix::LoopThrottleComponent::TickStats run_overrun(consolix::LoopThrottleComponent::CatchUp catch_up) {
+    consolix::AppComponentManager manager;
+    auto throttle = manager.add<consolix::LoopThrottleComponent>();
+
+    expect(manager.initialize(), "LoopThrottleComponent did not initialize");
+    throttle->set_fixed_rate(std::chrono::milliseconds(10), catch_up);
+    manager.process();
+    manager.process();
+    std::this_thread::sleep_for(std::chrono::milliseconds(45));
+
+    const auto start = std::chrono::steady_clock::now();
+    manager.process();
+    manager.process();
+    manager.process();
+    const long long elapsed = elapsed_ms(start);
+    if (catch_up == consolix::LoopThrottleComponent::CatchUp::Burst) {
+        expect(elapsed < 8, "burst catch-up must release missed ticks without waiting");
+    } else {
+        expect(elapsed >= 10, "skip and stretch must wait for the next deadline");
+    }
+    return throttle->tick_stats();
+}
+
+void run_catch_up_scenario() {
+    typedef consolix::LoopThrottleComponent::CatchUp CatchUp;
+    const consolix::LoopThrottleComponent::TickStats skip = run_overrun(CatchUp::Skip);
+    expect(skip.overruns == 1, "a stall must count as one overrun");
+    expect(skip.missed_ticks >= 3, "skip must drop the missed ticks");
+
+    const consolix::LoopThrottleComponent::TickStats burst = run_overrun(CatchUp::Burst);
+    expect(burst.overruns >= 1, "a stall must count as an overrun");
+    expect(burst.missed_ticks == 0, "burst must not drop ticks");
+
+    const consolix::LoopThrottleComponent::TickStats stretch = run_overrun(CatchUp::Stretch);
+    expect(stretch.overruns == 1, "a stall must count as one overrun");
+    expect(stretch.missed_ticks >= 3, "stretch must drop the missed ticks");
+    expect(stretch.lateness.max() >= 30000000, "lateness must record the stall");
+}
+
+void run_sub_millisecond_scenario() {
+    consolix::AppComponentManager manager;
+    auto throttle = manager.add<consolix::LoopThrottleComponent>(std::chrono::microseconds(200));
+
+    expect(manager.initialize(), "LoopThrottleComponent did not initialize");
+    expect(throttle->delay_ns() == std::chrono::microseconds(200), "sub-millisecond delays must be kept");
+    expect(throttle->delay() == std::chrono::milliseconds(0), "delay() must report whole milliseconds");
+    const std::chrono::milliseconds legacy_delay = throttle->delay();
+    expect(legacy_delay.count() == 0, "delay() must convert to milliseconds implicitly");
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 50; ++i) {
+        manager.process();
+    }
+    expect(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(10),
+           "sub-millisecond delays must not be rounded down");
+
+    throttle->set_hybrid_wait(true);
+    expect(throttle->hybrid_wait(), "hybrid waiting must be reported");
+    throttle->set_fixed_rate(std::chrono::microseconds(100));
+    manager.process();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        manager.process();
+    }
+    const long long elapsed = elapsed_ms(start);
+    const consolix::LoopThrottleComponent::TickStats stats = throttle->tick_stats();
+    expect(stats.ticks + stats.missed_ticks >= 1000, "every 100 us deadline must be accounted for");
+    expect(elapsed >= 99 && elapsed < 400, "a 100 us fixed rate must hold its cadence");
+}
+
 } // namespace
 
 int main() {
@@ -77,6 +171,9 @@ int main() {
         run_pre_wake_scenario();
         run_active_wake_scenario();
         run_set_delay_scenario();
+        run_fixed_rate_scenario();
+        run_catch_up_scenario();
+        run_sub_millisecond_scenario();
 
         std::cout << "LoopThrottleComponent checks passed." << std::endl;
         return 0;
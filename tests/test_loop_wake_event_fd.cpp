@@ -0,0 +1,244 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <consolix/core.hpp>
+#include <consolix/utils.hpp>
+
+#if defined(__linux__)
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void write_token(int fd) {
+    const std::uint64_t one = 1;
+    expect(::write(fd, &one, sizeof(one)) == static_cast<ssize_t>(sizeof(one)), "eventfd write must succeed");
+}
+
+class WokenComponent final : public consolix::IAppComponent {
+public:
+    std::atomic<int> calls{0};
+
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {
+        ++calls;
+    }
+};
+
+void run_local_scenario() {
+    consolix::LoopWakeService service;
+    expect(service.event_fd() == -1, "services start in in-process mode");
+    const int fd = service.enable_event_fd();
+    expect(fd >= 0 && service.event_fd() == fd, "enable_event_fd must expose the descriptor");
+    expect(service.enable_event_fd() == fd, "enable_event_fd must be idempotent");
+
+    consolix::LoopWakeService::Generation observed = service.generation();
+    service.wake_all();
+    pollfd descriptor = {};
+    descriptor.fd = fd;
+    descriptor.events = POLLIN;
+    expect(::poll(&descriptor, 1, 0) == 1, "wake_all must make the descriptor readable");
+    expect(service.wait_for_change(observed, std::chrono::milliseconds(100)), "waiter must observe wake_all");
+    expect(!service.wait_for_change(observed, std::chrono::milliseconds(20)),
+           "an observed wake must not be reported twice");
+
+    std::thread writer([fd]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        write_token(fd);
+    });
+    expect(service.wait_for_change(observed, std::chrono::milliseconds(2000)),
+           "a raw eventfd write must wake a blocked waiter");
+    writer.join();
+}
+
+void run_single_count_scenario() {
+    consolix::LoopWakeService service;
+    service.enable_event_fd();
+    const consolix::LoopWakeService::Generation start = service.generation();
+
+    consolix::LoopWakeService::Generation observed = start;
+    service.wake_all();
+    expect(service.wait_for_change(observed, std::chrono::milliseconds(100)), "waiter must observe wake_all");
+    expect(observed == start + 1 && service.generation() == start + 1,
+           "one wake_all must advance the generation by exactly one in descriptor mode");
+
+    service.wake_all();
+    expect(service.absorb_event_fd(), "absorb_event_fd must report the pending wake");
+    expect(service.generation() == start + 2, "an absorbed wake_all must advance the generation by exactly one");
+    observed = service.generation();
+    expect(!service.wait_for_change(observed, std::chrono::milliseconds(20)), "a drained wake must not be counted again");
+}
+
+void run_shared_waiters_scenario() {
+    consolix::LoopWakeService service;
+    const int fd = service.enable_event_fd();
+    std::atomic<int> woken(0);
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < 4; ++i) {
+        waiters.push_back(std::thread([&service, &woken]() {
+            consolix::LoopWakeService::Generation observed = service.generation();
+            if (service.wait_for_change(observed, std::chrono::milliseconds(3000))) {
+                ++woken;
+            }
+        }));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    write_token(fd);
+    for (std::size_t i = 0; i < waiters.size(); ++i) {
+        waiters[i].join();
+    }
+    expect(woken == 4, "one descriptor write must wake every blocked waiter");
+}
+
+void run_bounded_wakeups_scenario() {
+    consolix::LoopWakeService service;
+    service.enable_event_fd();
+    std::atomic<bool> stop(false);
+    std::atomic<int> changes[2];
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < 2; ++i) {
+        changes[i] = 0;
+        waiters.push_back(std::thread([&service, &stop, &changes, i]() {
+            consolix::LoopWakeService::Generation observed = service.generation();
+            while (!stop.load()) {
+                if (service.wait_for_change(observed, std::chrono::milliseconds(3000)) && !stop.load()) {
+                    ++changes[i];
+                }
+            }
+        }));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    service.wake_all();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const int first = changes[0].load();
+    const int second = changes[1].load();
+    stop = true;
+    service.wake_all();
+    for (std::size_t i = 0; i < waiters.size(); ++i) {
+        waiters[i].join();
+    }
+    expect(first >= 1 && second >= 1, "one wake_all must wake both blocked waiters");
+    expect(first <= 2 && second <= 2, "blocked waiters must not keep waking each other after one wake_all");
+}
+
+void run_attached_scenario() {
+    consolix::LoopWakeService producer;
+    consolix::LoopWakeService consumer;
+    const int fd = producer.enable_event_fd();
+    const int copy = ::dup(fd);
+    expect(consumer.attach_event_fd(copy), "attach_event_fd must adopt a descriptor");
+    expect(!consumer.attach_event_fd(copy), "a second descriptor must be rejected");
+
+    consolix::LoopWakeService::Generation observed = consumer.generation();
+    producer.wake_all();
+    expect(consumer.wait_for_change(observed, std::chrono::milliseconds(1000)),
+           "services sharing an eventfd must wake each other");
+}
+
+void run_cross_process_scenario() {
+    consolix::LoopWakeService service;
+    const int fd = service.enable_event_fd();
+
+    int sockets[2];
+    expect(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0, "socketpair must be created");
+    const pid_t child = ::fork();
+    expect(child >= 0, "fork must succeed");
+    if (child == 0) {
+        ::close(sockets[0]);
+        const int received = consolix::receive_file_descriptor(sockets[1]);
+        const std::uint64_t one = 1;
+        const bool ok = received >= 0 && ::write(received, &one, sizeof(one)) == static_cast<ssize_t>(sizeof(one));
+        ::_exit(ok ? 0 : 1);
+    }
+    ::close(sockets[1]);
+
+    consolix::LoopWakeService::Generation observed = service.generation();
+    expect(consolix::send_file_descriptor(sockets[0], fd), "descriptor must be sent over the socket");
+    const bool woke = service.wait_for_change(observed, std::chrono::milliseconds(3000));
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    ::close(sockets[0]);
+    expect(WIFEXITED(status) && WEXITSTATUS(status) == 0, "child must write the received descriptor");
+    expect(woke, "a write from another process must wake the waiter");
+}
+
+void run_reactor_scenario() {
+    consolix::ServiceLocator locator;
+    locator.register_service<consolix::LoopWakeService>();
+    const int fd = locator.get_service<consolix::LoopWakeService>().enable_event_fd();
+
+    consolix::AppComponentManager manager(locator);
+    auto woken = manager.add<WokenComponent>();
+    manager.set_schedule(woken, consolix::ComponentSchedule::on_wake());
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    runner.enable_reactor();
+    std::atomic<bool> woke(false);
+    std::thread controller([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        const int before = woken->calls.load();
+        write_token(fd);
+        for (int i = 0; i < 200 && woken->calls.load() == before; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        woke = woken->calls.load() > before;
+        runner.request_stop(0);
+    });
+
+    const int exit_code = runner.run_for_exit_code();
+    controller.join();
+    expect(exit_code == 0, "reactor runner must stop normally");
+    expect(woke.load(), "a raw eventfd write must wake the reactor and run on-wake components");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_local_scenario();
+        run_single_count_scenario();
+        run_shared_waiters_scenario();
+        run_bounded_wakeups_scenario();
+        run_attached_scenario();
+        run_cross_process_scenario();
+        run_reactor_scenario();
+
+        std::cout << "Loop wake eventfd checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Loop wake eventfd test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+#else
+
+int main() {
+    std::cout << "Loop wake eventfd checks skipped: eventfd is not available." << std::endl;
+    return 0;
+}
+
+#endif
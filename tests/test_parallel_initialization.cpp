@@ -0,0 +1,255 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+struct SharedConfig {
+};
+
+struct Journal {
+    std::mutex       mutex;
+    std::vector<int> order;
+    std::atomic<int> active{0};
+    std::atomic<int> max_active{0};
+
+    void enter(int id) {
+        const int now = ++active;
+        int seen = max_active.load();
+        while (now > seen && !max_active.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(40));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+        }
+        --active;
+    }
+
+    std::size_t position(int id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            if (order[i] == id) return i;
+        }
+        throw std::runtime_error("component was not initialized");
+    }
+};
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class JournalComponent : public consolix::IAppComponent {
+public:
+    JournalComponent(Journal& journal, int id) :
+        m_journal(journal),
+        m_id(id) {
+    }
+
+protected:
+    bool initialize() override {
+        m_journal.enter(m_id);
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+    }
+
+    Journal& m_journal;
+    int      m_id;
+    bool     m_initialized{false};
+};
+
+class IndependentComponent : public JournalComponent, public consolix::IInitDependencies {
+public:
+    using JournalComponent::JournalComponent;
+};
+
+class ConfigProvider final : public JournalComponent, public consolix::IInitDependencies {
+public:
+    using JournalComponent::JournalComponent;
+
+    std::vector<std::type_index> provided_services() const override {
+        return consolix::type_indices<SharedConfig>();
+    }
+
+protected:
+    bool initialize() override {
+        JournalComponent::initialize();
+        consolix::register_service<SharedConfig>();
+        return true;
+    }
+};
+
+class ConfigConsumer final : public JournalComponent, public consolix::IInitDependencies {
+public:
+    using JournalComponent::JournalComponent;
+
+    std::vector<std::type_index> required_services() const override {
+        return consolix::type_indices<SharedConfig>();
+    }
+
+protected:
+    bool initialize() override {
+        expect(consolix::has_service<SharedConfig>(), "required service must exist before initialize");
+        return JournalComponent::initialize();
+    }
+};
+
+class AfterConsumer final : public JournalComponent, public consolix::IInitDependencies {
+public:
+    using JournalComponent::JournalComponent;
+
+    std::vector<std::type_index> component_dependencies() const override {
+        return consolix::type_indices<ConfigConsumer>();
+    }
+};
+
+class BarrierComponent final : public JournalComponent {
+public:
+    using JournalComponent::JournalComponent;
+};
+
+template <int Id>
+class FailingComponent final : public consolix::IAppComponent, public consolix::IInitDependencies {
+protected:
+    bool initialize() override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(Id == 1 ? 30 : 0));
+        throw std::runtime_error("failure " + std::to_string(Id));
+    }
+
+    bool is_initialized() const override {
+        return false;
+    }
+
+    void process() override {
+    }
+};
+
+template <int Id>
+class CycleComponent final : public consolix::IAppComponent, public consolix::IInitDependencies {
+public:
+    std::vector<std::type_index> component_dependencies() const override {
+        return consolix::type_indices<CycleComponent<1 - Id>>();
+    }
+
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return false;
+    }
+
+    void process() override {
+    }
+};
+
+void run_parallel_waves_scenario() {
+    Journal journal;
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    manager.set_initialization_threads(4);
+
+    manager.add<IndependentComponent>(journal, 1);
+    manager.add<IndependentComponent>(journal, 2);
+    manager.add<AfterConsumer>(journal, 5);
+    manager.add<ConfigConsumer>(journal, 4);
+    manager.add<ConfigProvider>(journal, 3);
+    manager.add<BarrierComponent>(journal, 6);
+    manager.add<IndependentComponent>(journal, 7);
+    manager.add<IndependentComponent>(journal, 8);
+
+    const auto start = std::chrono::steady_clock::now();
+    expect(manager.initialize(), "parallel initialization must finish");
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    expect(journal.order.size() == 8, "every component must initialize once");
+    expect(journal.max_active.load() > 1, "independent components must overlap");
+    expect(elapsed < std::chrono::milliseconds(8 * 40), "parallel initialization must beat sequential time");
+    expect(journal.position(3) < journal.position(4), "service provider must initialize before its consumer");
+    expect(journal.position(4) < journal.position(5), "component dependency must initialize first");
+    for (int id = 1; id <= 5; ++id) {
+        expect(journal.position(id) < journal.position(6), "barrier must wait for earlier components");
+    }
+    expect(journal.position(6) < journal.position(7) && journal.position(6) < journal.position(8),
+           "components after a barrier must wait for it");
+    expect(locator.has_service<SharedConfig>(), "workers must register into the manager locator");
+}
+
+void run_sequential_fallback_scenario() {
+    Journal journal;
+    consolix::AppComponentManager manager;
+    manager.add<IndependentComponent>(journal, 1);
+    manager.add<IndependentComponent>(journal, 2);
+    manager.add<IndependentComponent>(journal, 3);
+
+    expect(manager.initialization_threads() <= 1, "parallel initialization must be opt-in");
+    expect(manager.initialize(), "sequential initialization must finish");
+    expect(journal.max_active.load() == 1, "sequential initialization must not overlap");
+    expect(journal.order == std::vector<int>({1, 2, 3}), "sequential initialization must keep order");
+}
+
+void run_deterministic_error_scenario() {
+    for (int attempt = 0; attempt < 5; ++attempt) {
+        consolix::AppComponentManager manager;
+        manager.set_initialization_threads(3);
+        manager.add<FailingComponent<1>>();
+        manager.add<FailingComponent<2>>();
+
+        std::string message;
+        try {
+            manager.initialize();
+        } catch (const std::runtime_error& e) {
+            message = e.what();
+        }
+        expect(message == "failure 1", "the earliest registered failure must be reported");
+    }
+}
+
+void run_cycle_scenario() {
+    consolix::AppComponentManager manager;
+    manager.set_initialization_threads(2);
+    manager.add<CycleComponent<0>>();
+    manager.add<CycleComponent<1>>();
+
+    bool threw = false;
+    try {
+        manager.initialize();
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    expect(threw, "dependency cycles must be reported");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_parallel_waves_scenario();
+        run_sequential_fallback_scenario();
+        run_deterministic_error_scenario();
+        run_cycle_scenario();
+
+        std::cout << "Parallel initialization checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Parallel initialization test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
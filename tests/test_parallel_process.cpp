@@ -0,0 +1,150 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+struct Counters {
+    std::atomic<int> active{0};
+    std::atomic<int> max_active{0};
+    std::atomic<int> finished{0};
+    int              seen_by_sequential = -1;
+    int              after_failure_calls = 0;
+};
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class BaseComponent : public consolix::IAppComponent {
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+};
+
+class WorkerComponent final : public BaseComponent, public consolix::IParallelProcess {
+public:
+    explicit WorkerComponent(Counters& counters) :
+        m_counters(counters) {
+    }
+
+protected:
+    void process() override {
+        const int now = ++m_counters.active;
+        int seen = m_counters.max_active.load();
+        while (now > seen && !m_counters.max_active.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        --m_counters.active;
+        ++m_counters.finished;
+    }
+
+private:
+    Counters& m_counters;
+};
+
+class SequentialComponent final : public BaseComponent {
+public:
+    explicit SequentialComponent(Counters& counters) :
+        m_counters(counters) {
+    }
+
+protected:
+    void process() override {
+        m_counters.seen_by_sequential = m_counters.finished.load();
+        ++m_counters.after_failure_calls;
+    }
+
+private:
+    Counters& m_counters;
+};
+
+template <int Id>
+class FailingWorker final : public BaseComponent, public consolix::IParallelProcess {
+protected:
+    void process() override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(Id == 1 ? 20 : 0));
+        throw std::runtime_error("process failure " + std::to_string(Id));
+    }
+};
+
+void run_parallel_stage_scenario() {
+    Counters counters;
+    consolix::AppComponentManager manager;
+    manager.set_processing_threads(4);
+    manager.add<WorkerComponent>(counters);
+    manager.add<WorkerComponent>(counters);
+    manager.add<WorkerComponent>(counters);
+    manager.add<WorkerComponent>(counters);
+    manager.add<SequentialComponent>(counters);
+
+    const auto start = std::chrono::steady_clock::now();
+    manager.process();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    expect(counters.finished.load() == 4, "every parallel component must process once");
+    expect(counters.max_active.load() > 1, "independent components must overlap");
+    expect(elapsed < std::chrono::milliseconds(4 * 30), "parallel stage must beat sequential time");
+    expect(counters.seen_by_sequential == 4, "sequential component must run after the join barrier");
+
+    manager.process();
+    expect(counters.finished.load() == 8, "the persistent pool must serve later passes");
+}
+
+void run_sequential_default_scenario() {
+    Counters counters;
+    consolix::AppComponentManager manager;
+    manager.add<WorkerComponent>(counters);
+    manager.add<WorkerComponent>(counters);
+
+    manager.process();
+    expect(counters.max_active.load() == 1, "parallel processing must be opt-in");
+}
+
+void run_exception_scenario() {
+    for (int attempt = 0; attempt < 5; ++attempt) {
+        Counters counters;
+        consolix::AppComponentManager manager;
+        manager.set_processing_threads(3);
+        manager.add<FailingWorker<1>>();
+        manager.add<FailingWorker<2>>();
+        manager.add<SequentialComponent>(counters);
+
+        std::string message;
+        try {
+            manager.process();
+        } catch (const std::runtime_error& e) {
+            message = e.what();
+        }
+        expect(message == "process failure 1", "the earliest registered failure must be rethrown");
+        expect(counters.after_failure_calls == 0, "stages after a failure must be skipped");
+    }
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_parallel_stage_scenario();
+        run_sequential_default_scenario();
+        run_exception_scenario();
+
+        std::cout << "Parallel process checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Parallel process test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
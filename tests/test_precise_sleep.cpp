@@ -0,0 +1,92 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void run_absolute_sleep_scenario() {
+    for (int i = 0; i < 20; ++i) {
+        const Clock::time_point deadline = Clock::now() + std::chrono::microseconds(150);
+        consolix::sleep_until_precise(deadline);
+        expect(Clock::now() >= deadline, "an absolute sleep must not end before its deadline");
+    }
+    const Clock::time_point start = Clock::now();
+    consolix::sleep_for_precise(std::chrono::microseconds(300));
+    expect(Clock::now() - start >= std::chrono::microseconds(300), "a relative sleep must last its duration");
+    consolix::sleep_for_precise(std::chrono::nanoseconds(-5));
+}
+
+void run_hybrid_sleep_scenario() {
+    consolix::HybridSleeper sleeper(std::chrono::microseconds(200));
+    expect(sleeper.spin_margin() <= sleeper.max_spin(), "the spin margin must be capped");
+
+    for (int i = 0; i < 200; ++i) {
+        const Clock::time_point deadline = Clock::now() + std::chrono::microseconds(100);
+        sleeper.sleep_until(deadline);
+        expect(Clock::now() >= deadline, "a hybrid sleep must not end before its deadline");
+    }
+    expect(sleeper.spin_margin() <= std::chrono::microseconds(200), "calibration must respect the cap");
+
+    consolix::HybridSleeper no_spin(std::chrono::nanoseconds(0));
+    expect(no_spin.spin_margin() == std::chrono::nanoseconds(0), "a zero cap must disable spinning");
+    const Clock::time_point deadline = Clock::now() + std::chrono::microseconds(100);
+    no_spin.sleep_until(deadline);
+    expect(Clock::now() >= deadline, "a sleep without spinning must still reach its deadline");
+}
+
+void run_hybrid_wake_scenario() {
+    consolix::LoopWakeService service;
+    consolix::HybridSleeper sleeper;
+    consolix::LoopWakeService::Generation observed = service.generation();
+
+    Clock::time_point deadline = Clock::now() + std::chrono::microseconds(250);
+    expect(!service.wait_until_change(observed, deadline, sleeper), "an unwoken wait must time out");
+    expect(Clock::now() >= deadline, "an unwoken wait must reach its deadline");
+
+    std::atomic<bool> woken(false);
+    std::thread waiter([&]() {
+        consolix::HybridSleeper thread_sleeper;
+        consolix::LoopWakeService::Generation thread_observed = service.generation();
+        woken = service.wait_until_change(thread_observed, Clock::now() + std::chrono::seconds(5), thread_sleeper);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const Clock::time_point woke_at = Clock::now();
+    service.wake_all();
+    waiter.join();
+    expect(woken.load(), "wake_all must end a hybrid wait");
+    expect(Clock::now() - woke_at < std::chrono::seconds(1), "wake_all must end a hybrid wait promptly");
+
+    service.wake_all();
+    deadline = Clock::now() + std::chrono::seconds(5);
+    expect(service.wait_until_change(observed, deadline, sleeper), "an earlier wake must be observed at once");
+    expect(!service.wait_for_change(observed, std::chrono::microseconds(200)),
+           "nanosecond timeouts must be accepted");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_absolute_sleep_scenario();
+        run_hybrid_sleep_scenario();
+        run_hybrid_wake_scenario();
+
+        std::cout << "Precise sleep checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Precise sleep test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,246 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class PipeComponent final : public consolix::IAppComponent {
+public:
+    std::atomic<int> write_fd{-1};
+    std::atomic<int> reads{0};
+    std::atomic<int> ticks{0};
+    std::atomic<int> passes{0};
+
+    ~PipeComponent() override {
+        if (m_read_fd >= 0) {
+            ::close(m_read_fd);
+        }
+        if (write_fd >= 0) {
+            ::close(write_fd);
+        }
+    }
+
+protected:
+    bool initialize() override {
+        int fds[2];
+        if (::pipe2(fds, O_NONBLOCK | O_CLOEXEC) != 0) {
+            return false;
+        }
+        m_read_fd = fds[0];
+        write_fd = fds[1];
+
+        auto& reactor = consolix::get_service<consolix::Reactor>();
+        reactor.add_fd(m_read_fd, EPOLLIN, [this](std::uint32_t) {
+            char buffer[16];
+            while (::read(m_read_fd, buffer, sizeof(buffer)) > 0) {
+                ++reads;
+            }
+        });
+        m_timer = reactor.add_timer(std::chrono::milliseconds(20), [this](std::uint64_t expirations) {
+            ticks += static_cast<int>(expirations);
+        });
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+        ++passes;
+    }
+
+private:
+    int  m_read_fd{-1};
+    int  m_timer{-1};
+    bool m_initialized{false};
+};
+
+void run_standalone_reactor_scenario() {
+    consolix::Reactor reactor;
+    expect(reactor.run_once(std::chrono::milliseconds(0)) == 0, "empty poll must dispatch nothing");
+
+    int fds[2];
+    expect(::pipe2(fds, O_NONBLOCK | O_CLOEXEC) == 0, "pipe must be created");
+    int readable = 0;
+    reactor.add_fd(fds[0], EPOLLIN, [&readable, &fds](std::uint32_t events) {
+        char value = 0;
+        if ((events & EPOLLIN) != 0 && ::read(fds[0], &value, 1) == 1) {
+            ++readable;
+        }
+    });
+    expect(::write(fds[1], "x", 1) == 1, "pipe write must succeed");
+    expect(reactor.run_once(std::chrono::milliseconds(1000)) == 1, "readable pipe must dispatch its handler");
+    expect(readable == 1, "pipe handler must read the byte");
+
+    reactor.remove_fd(fds[0]);
+    expect(::write(fds[1], "x", 1) == 1, "pipe write must succeed");
+    expect(reactor.run_once(std::chrono::milliseconds(0)) == 0, "removed descriptors must not dispatch");
+
+    int fired = 0;
+    const int timer = reactor.add_timer(std::chrono::milliseconds(5), std::chrono::milliseconds(0),
+        [&fired](std::uint64_t expirations) {
+            fired += static_cast<int>(expirations);
+        });
+    expect(reactor.run_once(std::chrono::milliseconds(1000)) == 1, "one-shot timer must fire");
+    expect(fired == 1, "one-shot timer must report one expiration");
+    reactor.cancel_timer(timer);
+    expect(reactor.registration_count() == 0, "cancelled timer must be unregistered");
+
+    const auto started = std::chrono::steady_clock::now();
+    std::thread waker([&reactor]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        reactor.wake();
+    });
+    expect(reactor.run_once(std::chrono::milliseconds(5000)) == 0, "wake must not count as a dispatch");
+    waker.join();
+    expect(std::chrono::steady_clock::now() - started < std::chrono::milliseconds(1000),
+           "wake must interrupt the wait");
+
+    for (int i = 0; i < 10; ++i) {
+        const auto sub_ms_started = std::chrono::steady_clock::now();
+        expect(reactor.run_once(std::chrono::microseconds(300)) == 0, "a sub-millisecond timeout must not dispatch");
+        const auto waited = std::chrono::steady_clock::now() - sub_ms_started;
+        expect(waited >= std::chrono::microseconds(300), "a sub-millisecond timeout must not end early");
+        expect(waited < std::chrono::milliseconds(50), "a sub-millisecond timeout must not be stretched");
+    }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(400);
+    reactor.run_until(deadline);
+    expect(std::chrono::steady_clock::now() >= deadline, "run_until must wait for its deadline");
+    expect(reactor.run_once(std::chrono::milliseconds(0)) == 0, "the deadline timer must not count as a dispatch");
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+void run_runner_reactor_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto component = manager.add<PipeComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    expect(runner.enable_reactor(), "reactor mode must be available on Linux");
+
+    std::atomic<bool> woke_promptly(false);
+    std::thread controller([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(120));
+        const int before = component->reads.load();
+        if (::write(component->write_fd, "x", 1) != 1) {
+            runner.request_stop(3);
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        if (component->reads.load() == before) {
+            runner.request_stop(4);
+            return;
+        }
+
+        const int passes = component->passes.load();
+        consolix::wake_loop(locator);
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        woke_promptly = component->passes.load() > passes;
+        runner.request_stop(0);
+    });
+
+    const auto started = std::chrono::steady_clock::now();
+    const int exit_code = runner.run_for_exit_code();
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+    controller.join();
+
+    expect(exit_code == 0, "reactor runner must stop normally after a pipe read");
+    expect(component->reads >= 1, "pipe data must reach the component handler");
+    expect(component->ticks >= 4, "reactor timer must fire about every 20 ms");
+    expect(woke_promptly.load(), "wake_loop must interrupt the reactor wait");
+    expect(component->passes < 60, "reactor loop must not run passes without events");
+    expect(elapsed < std::chrono::milliseconds(2000), "stop must interrupt the reactor wait");
+}
+
+void run_registered_reactor_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto reactor = std::make_shared<consolix::Reactor>();
+    locator.register_service<consolix::Reactor>([reactor]() {
+        return reactor;
+    });
+
+    int fds[2] = {-1, -1};
+    expect(::pipe(fds) == 0, "pipe must be created");
+    consolix::ConsoleApplicationRunner runner(manager);
+    std::atomic<int> reads(0);
+    reactor->add_fd(fds[0], EPOLLIN, [&](std::uint32_t) {
+        char byte = 0;
+        if (::read(fds[0], &byte, 1) == 1) {
+            ++reads;
+            runner.request_stop(0);
+        }
+    });
+    expect(runner.enable_reactor(), "reactor mode must be available on Linux");
+
+    std::thread writer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        if (::write(fds[1], "x", 1) != 1) {
+            runner.request_stop(5);
+        }
+    });
+    std::atomic<bool> finished(false);
+    std::thread watchdog([&]() {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!finished && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (!finished) {
+            runner.request_stop(6);
+        }
+    });
+    const int exit_code = runner.run_for_exit_code();
+    finished = true;
+    writer.join();
+    watchdog.join();
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    expect(exit_code == 0, "the descriptor on the registered reactor must stop the runner");
+    expect(reads == 1, "the runner must poll the reactor registered by the application");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_standalone_reactor_scenario();
+        run_runner_reactor_scenario();
+        run_registered_reactor_scenario();
+
+        std::cout << "Reactor checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Reactor test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+#else
+
+int main() {
+    std::cout << "Reactor checks skipped: epoll is not available." << std::endl;
+    return 0;
+}
+
+#endif
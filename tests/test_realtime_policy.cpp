@@ -0,0 +1,207 @@
+#include <cerrno>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+int current_scheduler() {
+#   if defined(__linux__)
+    int policy = 0;
+    sched_param param{};
+    ::pthread_getschedparam(::pthread_self(), &policy, &param);
+    return policy;
+#   else
+    return 0;
+#   endif
+}
+
+void expect_outcome(const consolix::RealtimeSetting& setting, const char* message) {
+    expect(setting.requested, message);
+    expect(setting.applied != (setting.error != 0), message);
+}
+
+class ObservingComponent final : public consolix::IAppComponent {
+public:
+    consolix::ConsoleApplicationRunner* runner{nullptr};
+    int scheduler_at_init{-1};
+
+protected:
+    bool initialize() override {
+        scheduler_at_init = current_scheduler();
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+        runner->request_stop(0);
+    }
+
+private:
+    bool m_initialized{false};
+};
+
+void test_policy_builders() {
+    const consolix::RealtimePolicy disabled;
+    expect(!disabled.enabled(), "the default policy must request nothing");
+
+    const consolix::RealtimePolicy locked = consolix::RealtimePolicy::locked(
+        consolix::RealtimeScheduler::RoundRobin, 10);
+    expect(locked.enabled(), "the locked preset must request settings");
+    expect(locked.scheduler() == consolix::RealtimeScheduler::RoundRobin, "the scheduler must be kept");
+    expect(locked.priority() == 10, "the priority must be kept");
+    expect(locked.memory_lock() && locked.thp_disabled(), "the preset must lock memory and disable THP");
+    expect(locked.stack_prefault() == CONSOLIX_REALTIME_STACK_PREFAULT_KB * 1024u, "stack prefault default");
+    expect(locked.heap_prefault() == CONSOLIX_REALTIME_HEAP_PREFAULT_KB * 1024u, "heap prefault default");
+}
+
+void test_prefault_outcomes() {
+    consolix::RealtimePolicy policy;
+    policy.set_stack_prefault(64 * 1024).set_heap_prefault(1024 * 1024);
+    consolix::ScopedRealtime realtime(policy);
+    const consolix::RealtimeReport& report = realtime.report();
+
+    expect(!report.scheduler.requested && !report.memory_lock.requested && !report.thp_disabled.requested,
+           "unrequested settings must not be reported as requested");
+    expect_outcome(report.stack_prefault, "the stack prefault must report its outcome");
+    expect_outcome(report.heap_prefault, "the heap prefault must report its outcome");
+#   if defined(__linux__)
+    expect(report.stack_prefault.applied && report.stack_bytes == 64 * 1024,
+           "a small stack prefault must succeed on Linux");
+#   if defined(__GLIBC__)
+    expect(report.heap_prefault.applied && report.heap_bytes == 1024 * 1024,
+           "the heap prefault must succeed with glibc");
+#   endif
+#   else
+    expect(report.stack_prefault.error == ENOSYS, "unsupported platforms must report ENOSYS");
+#   endif
+    expect(report.complete() == (report.stack_prefault.applied && report.heap_prefault.applied),
+           "complete() must reflect the requested settings");
+
+    consolix::RealtimePolicy oversized;
+    oversized.set_stack_prefault(static_cast<std::size_t>(1) << 40);
+    consolix::ScopedRealtime rejected(oversized);
+    expect(rejected.report().stack_prefault.failed(), "a prefault deeper than the stack must be refused");
+    expect(rejected.report().stack_bytes == 0, "a refused prefault must not touch the stack");
+    expect(!rejected.report().complete(), "a refused setting must make the report incomplete");
+}
+
+void test_scheduler_is_restored() {
+    const int before = current_scheduler();
+    consolix::RealtimeReport report;
+    {
+        consolix::RealtimePolicy policy;
+        policy.set_scheduler(consolix::RealtimeScheduler::Fifo, 1000);
+        consolix::ScopedRealtime realtime(policy);
+        report = realtime.report();
+#       if defined(__linux__)
+        if (report.scheduler.applied) {
+            expect(current_scheduler() == SCHED_FIFO, "an applied scheduler must be in effect");
+            expect(report.priority == ::sched_get_priority_max(SCHED_FIFO),
+                   "the priority must be clamped to the scheduler's range");
+        } else {
+            expect(report.scheduler.error == EPERM, "an unprivileged process must report EPERM");
+            expect(current_scheduler() == before, "a failed request must leave the scheduler alone");
+        }
+#       endif
+    }
+    expect_outcome(report.scheduler, "the scheduler must report its outcome");
+    expect(current_scheduler() == before, "the scheduler must be restored on scope exit");
+}
+
+void test_runner_applies_policy_before_initialization() {
+    int before = -1;
+    int after = -1;
+    consolix::RealtimeReport report;
+    int scheduler_at_init = -1;
+    int exit_code = -1;
+    bool policy_kept = false;
+
+    // Runs on its own thread so the test's main thread never joins the real-time class.
+    std::thread thread([&]() {
+        consolix::ServiceLocator locator;
+        consolix::AppComponentManager manager(locator);
+        auto component = manager.add<ObservingComponent>();
+
+        consolix::ConsoleApplicationRunner runner(manager);
+        component->runner = &runner;
+        runner.set_realtime_policy(consolix::RealtimePolicy::locked(consolix::RealtimeScheduler::Fifo, 1));
+        policy_kept = runner.realtime_policy().enabled();
+
+        before = current_scheduler();
+        exit_code = runner.run_for_exit_code();
+        after = current_scheduler();
+        report = runner.realtime_report();
+        scheduler_at_init = component->scheduler_at_init;
+    });
+    thread.join();
+
+#   if defined(__linux__)
+    ::munlockall();
+#   endif
+
+    expect(policy_kept, "the runner must keep the policy");
+    expect(exit_code == 0, "the runner must stop normally");
+    expect_outcome(report.scheduler, "the runner must report the scheduler");
+    expect_outcome(report.memory_lock, "the runner must report memory locking");
+    expect_outcome(report.stack_prefault, "the runner must report the stack prefault");
+    expect_outcome(report.heap_prefault, "the runner must report the heap prefault");
+    expect_outcome(report.thp_disabled, "the runner must report the THP setting");
+#   if defined(__linux__)
+    expect(scheduler_at_init == (report.scheduler.applied ? SCHED_FIFO : before),
+           "the scheduler must be in effect when components initialize");
+#   endif
+    expect(after == before, "the runner must restore the scheduler when the run ends");
+}
+
+void test_runner_without_policy() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto component = manager.add<ObservingComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    component->runner = &runner;
+    expect(runner.run_for_exit_code() == 0, "the runner must stop normally");
+
+    const consolix::RealtimeReport report = runner.realtime_report();
+    expect(!report.scheduler.requested && !report.memory_lock.requested &&
+           !report.stack_prefault.requested && !report.heap_prefault.requested &&
+           !report.thp_disabled.requested, "no setting must be requested by default");
+    expect(report.complete(), "an empty report must be complete");
+}
+
+} // namespace
+
+int main() {
+    try {
+        test_policy_builders();
+        test_prefault_outcomes();
+        test_scheduler_is_restored();
+        test_runner_applies_policy_before_initialization();
+        test_runner_without_policy();
+
+        std::cout << "Real-time policy checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Real-time policy test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,370 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+struct FirstService {
+    int value = 1;
+};
+
+struct SecondService {
+    int value = 2;
+};
+
+struct LateService {
+    int value = 3;
+};
+
+struct MissingService {
+};
+
+struct LazyService {
+    int value = 4;
+};
+
+struct FlakyService {
+};
+
+struct WarmService {
+};
+
+struct ShardService {
+    int value = 5;
+};
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void run_freeze_scenario() {
+    auto& locator = consolix::ServiceLocator::get_instance();
+    locator.clear_all();
+
+    locator.register_service<FirstService>();
+    locator.register_service<SecondService>([]() {
+        auto service = std::make_shared<SecondService>();
+        service->value = 20;
+        return service;
+    });
+
+    FirstService* first_before = &locator.get_service<FirstService>();
+
+    locator.freeze();
+    expect(locator.is_frozen(), "locator must report frozen state");
+    expect(&locator.get_service<FirstService>() == first_before,
+           "frozen lookup must return the registered instance");
+    expect(locator.get_service<SecondService>().value == 20,
+           "frozen lookup must return creator result");
+    expect(locator.get_service_ptr<SecondService>()->value == 20,
+           "frozen shared lookup must return creator result");
+    expect(locator.has_service<FirstService>(), "frozen has_service must find service");
+    expect(!locator.has_service<MissingService>(), "frozen has_service must miss unknown service");
+    expect(!locator.find_service<MissingService>(), "frozen find_service must miss unknown service");
+
+    bool threw = false;
+    try {
+        (void)locator.get_service<MissingService>();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    expect(threw, "frozen get_service must throw for unknown service");
+
+    threw = false;
+    try {
+        locator.register_service<FirstService>();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    expect(threw, "frozen locator must reject duplicate registrations");
+}
+
+void run_late_registration_scenario() {
+    auto& locator = consolix::ServiceLocator::get_instance();
+    expect(locator.is_frozen(), "late registration scenario expects a frozen locator");
+
+    locator.register_service<LateService>();
+    expect(locator.is_frozen(), "late registration must keep the locator frozen");
+    expect(locator.get_service<LateService>().value == 3,
+           "late registration must be visible to frozen lookups");
+    expect(locator.get_service<FirstService>().value == 1,
+           "late registration must keep earlier services visible");
+}
+
+void run_concurrent_reader_scenario() {
+    auto& locator = consolix::ServiceLocator::get_instance();
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 4; ++i) {
+        readers.push_back(std::thread([&locator, &failed]() {
+            for (int j = 0; j < 10000; ++j) {
+                if (locator.get_service<FirstService>().value != 1 ||
+                    locator.get_service<SecondService>().value != 20) {
+                    failed.store(true);
+                }
+            }
+        }));
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    expect(!failed.load(), "concurrent frozen readers must observe registered services");
+}
+
+template <int N>
+struct NumberedService {
+    int value = N;
+};
+
+template <int N>
+void register_numbered(consolix::ServiceLocator& locator) {
+    register_numbered<N - 1>(locator);
+    locator.register_service<NumberedService<N>>();
+}
+
+template <>
+void register_numbered<0>(consolix::ServiceLocator&) {
+}
+
+void run_snapshot_retention_scenario() {
+    consolix::ServiceLocator locator;
+    locator.register_service<FirstService>();
+    locator.freeze();
+    expect(locator.retained_snapshots() == 1, "freeze must publish one snapshot");
+
+    std::atomic<bool> stop(false);
+    std::atomic<bool> failed(false);
+    std::thread reader([&locator, &stop, &failed]() {
+        while (!stop.load()) {
+            if (locator.get_service<FirstService>().value != 1) {
+                failed.store(true);
+            }
+        }
+    });
+    register_numbered<32>(locator);
+    for (int i = 0; i < 100; ++i) {
+        locator.freeze();
+    }
+    stop.store(true);
+    reader.join();
+
+    expect(!failed.load(), "lookups must stay valid while snapshots are replaced");
+    expect(locator.get_service<NumberedService<32>>().value == 32,
+           "late registrations must be visible to frozen lookups");
+    expect(locator.retained_snapshots() == 33,
+           "retained snapshots must be bounded by the late registrations");
+
+    locator.unfreeze();
+    expect(locator.retained_snapshots() == 0, "unfreeze must free every snapshot");
+    locator.freeze();
+    expect(locator.retained_snapshots() == 1, "a new freeze must start from one snapshot");
+    locator.clear_all();
+    expect(locator.retained_snapshots() == 0, "clear_all must free every snapshot");
+}
+
+void run_clear_scenario() {
+    auto& locator = consolix::ServiceLocator::get_instance();
+    locator.clear_all();
+
+    expect(!locator.is_frozen(), "clear_all must unfreeze the locator");
+    expect(!locator.has_service<FirstService>(), "clear_all must remove services");
+
+    locator.register_service<FirstService>();
+    expect(locator.get_service<FirstService>().value == 1,
+           "unfrozen locator must accept new registrations");
+    locator.clear_all();
+}
+
+void run_service_ref_scenario() {
+    auto& locator = consolix::ServiceLocator::get_instance();
+    locator.clear_all();
+
+    consolix::ServiceRef<FirstService> ref;
+    expect(ref.get() == nullptr, "ServiceRef must resolve to null before registration");
+    expect(!ref, "ServiceRef must convert to false before registration");
+
+    bool threw = false;
+    try {
+        (void)*ref;
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    expect(threw, "ServiceRef dereference must throw for unknown service");
+
+    locator.register_service<FirstService>();
+    FirstService* first = ref.get();
+    expect(first == &locator.get_service<FirstService>(),
+           "ServiceRef must re-resolve after registration");
+
+    const consolix::ServiceLocator::Generation generation = locator.generation();
+    locator.freeze();
+    expect(locator.generation() == generation, "freeze must not change the generation");
+    expect(ref.get() == first, "ServiceRef must keep its cached pointer");
+    expect(ref->value == 1, "ServiceRef member access must reach the service");
+
+    locator.register_service<SecondService>();
+    expect(locator.generation() != generation, "registration must change the generation");
+    expect(ref.get() == first, "ServiceRef must re-resolve to the same service");
+
+    locator.clear_all();
+    expect(ref.get() == nullptr, "ServiceRef must drop the pointer after clear_all");
+
+    locator.register_service<FirstService>([]() {
+        auto service = std::make_shared<FirstService>();
+        service->value = 10;
+        return service;
+    });
+    expect(ref->value == 10, "ServiceRef must resolve the replacement service");
+    locator.clear_all();
+}
+
+void run_lazy_scenario() {
+    auto& locator = consolix::ServiceLocator::get_instance();
+    locator.clear_all();
+
+    std::atomic<int> lazy_builds(0);
+    locator.register_lazy_service<LazyService>([&lazy_builds]() {
+        lazy_builds.fetch_add(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        return std::make_shared<LazyService>();
+    });
+
+    expect(lazy_builds.load() == 0, "lazy registration must not build the service");
+    expect(locator.has_service<LazyService>(), "lazy service must count as registered");
+
+    locator.freeze();
+
+    std::vector<std::thread> readers;
+    std::atomic<int> mismatches(0);
+    LazyService* expected = nullptr;
+    std::mutex expected_mutex;
+    for (int i = 0; i < 4; ++i) {
+        readers.push_back(std::thread([&]() {
+            LazyService* service = &locator.get_service<LazyService>();
+            std::lock_guard<std::mutex> lock(expected_mutex);
+            if (!expected) {
+                expected = service;
+            } else if (expected != service) {
+                mismatches.fetch_add(1);
+            }
+        }));
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    expect(lazy_builds.load() == 1, "concurrent first lookups must build the service once");
+    expect(mismatches.load() == 0, "concurrent first lookups must observe one instance");
+    expect(locator.find_service<LazyService>().get() == expected,
+           "find_service must return the built lazy instance");
+
+    int flaky_attempts = 0;
+    locator.register_lazy_service<FlakyService>([&flaky_attempts]() -> std::shared_ptr<FlakyService> {
+        if (++flaky_attempts == 1) {
+            throw std::runtime_error("first attempt fails");
+        }
+        return std::make_shared<FlakyService>();
+    });
+
+    bool threw = false;
+    try {
+        locator.warm_up<FlakyService>();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    expect(threw, "warm_up must propagate factory errors");
+    expect(locator.find_service<FlakyService>() != nullptr, "lazy factory must be retried after an error");
+    expect(flaky_attempts == 2, "successful retry must build once");
+
+    int warm_builds = 0;
+    locator.register_lazy_service<WarmService>([&warm_builds]() {
+        ++warm_builds;
+        return std::make_shared<WarmService>();
+    });
+    locator.warm_up_all();
+    locator.warm_up_all();
+    expect(warm_builds == 1, "warm_up_all must build pending lazy services once");
+
+    locator.clear_all();
+}
+
+void run_scoped_locator_scenario() {
+    auto& global = consolix::ServiceLocator::get_instance();
+    global.clear_all();
+    global.register_service<FirstService>();
+
+    consolix::ServiceLocator shard(global);
+    expect(shard.parent() == &global, "child locator must report its parent");
+    expect(&shard.get_service<FirstService>() == &global.get_service<FirstService>(),
+           "child locator must fall back to the parent");
+    expect(!global.has_service<ShardService>(), "parent must not see child services");
+
+    shard.register_service<ShardService>();
+    shard.register_service<FirstService>([]() {
+        auto service = std::make_shared<FirstService>();
+        service->value = 11;
+        return service;
+    });
+    expect(shard.get_service<FirstService>().value == 11, "child registration must shadow the parent");
+    expect(global.get_service<FirstService>().value == 1, "shadowing must not touch the parent");
+
+    consolix::ServiceRef<SecondService> second(shard);
+    expect(second.get() == nullptr, "child ServiceRef must miss before parent registration");
+    shard.freeze();
+    global.register_service<SecondService>();
+    expect(second.get() == &global.get_service<SecondService>(),
+           "child ServiceRef must observe parent registrations");
+
+    expect(&consolix::ServiceLocator::current() == &global, "unbound thread must use the global locator");
+    {
+        consolix::ServiceLocator::Scope scope(shard);
+        expect(&consolix::ServiceLocator::current() == &shard, "scope must bind the child locator");
+        expect(consolix::has_service<ShardService>(), "service_utils must use the bound locator");
+        consolix::ServiceRef<ShardService> ref;
+        expect(ref->value == 5, "default ServiceRef must bind to the current locator");
+        expect(ref.locator() == &shard, "default ServiceRef must remember the bound locator");
+
+        std::thread other([&]() {
+            expect(&consolix::ServiceLocator::current() == &global, "scope must be thread-local");
+        });
+        other.join();
+    }
+    expect(&consolix::ServiceLocator::current() == &global, "scope must restore the previous locator");
+
+    shard.clear_all();
+    expect(!shard.has_service<ShardService>(), "child clear_all must remove child services");
+    expect(shard.has_service<FirstService>(), "child clear_all must keep parent services visible");
+    global.clear_all();
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_freeze_scenario();
+        run_late_registration_scenario();
+        run_concurrent_reader_scenario();
+        run_snapshot_retention_scenario();
+        run_clear_scenario();
+        run_service_ref_scenario();
+        run_lazy_scenario();
+        run_scoped_locator_scenario();
+
+        std::cout << "ServiceLocator checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "ServiceLocator test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,267 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+long long elapsed_ms(Clock::time_point since) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - since).count();
+}
+
+struct Store {};
+
+class SlowShutdownComponent :
+        public consolix::IAppComponent,
+        public consolix::IShutdownable {
+public:
+    explicit SlowShutdownComponent(int delay_ms = 0) :
+        m_delay_ms(delay_ms) {
+    }
+
+    std::atomic<bool>        finished{false};
+    std::atomic<long long>   started_at{0};
+    std::atomic<long long>   finished_at{0};
+
+    void wait_finished() const {
+        while (!finished.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {}
+
+    void shutdown(int) override {
+        started_at = now_us();
+        std::this_thread::sleep_for(std::chrono::milliseconds(m_delay_ms));
+        finished_at = now_us();
+        finished = true;
+    }
+
+private:
+    int m_delay_ms;
+
+    static long long now_us() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now().time_since_epoch()).count();
+    }
+};
+
+class StoreComponent final :
+        public SlowShutdownComponent,
+        public consolix::IInitDependencies {
+public:
+    explicit StoreComponent(int delay_ms) :
+        SlowShutdownComponent(delay_ms) {
+    }
+
+    std::vector<std::type_index> provided_services() const override {
+        return consolix::type_indices<Store>();
+    }
+};
+
+class StoreClient final :
+        public SlowShutdownComponent,
+        public consolix::IInitDependencies {
+public:
+    explicit StoreClient(int delay_ms) :
+        SlowShutdownComponent(delay_ms) {
+    }
+
+    std::vector<std::type_index> required_services() const override {
+        return consolix::type_indices<Store>();
+    }
+};
+
+struct Journal {
+    std::atomic<int> entries{0};
+};
+
+/// Writes to a service after overrunning its shutdown deadline.
+class JournalingComponent final : public SlowShutdownComponent {
+public:
+    explicit JournalingComponent(int delay_ms) :
+        SlowShutdownComponent(delay_ms) {
+    }
+
+    std::atomic<bool> journaled{false};
+
+protected:
+    void shutdown(int signal) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        try {
+            ++consolix::get_service<Journal>().entries;
+            journaled = true;
+        } catch (const std::exception&) {
+        }
+        SlowShutdownComponent::shutdown(signal);
+    }
+};
+
+class FailingShutdownComponent final :
+        public consolix::IAppComponent,
+        public consolix::IShutdownable {
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {}
+
+    void shutdown(int) override {
+        throw std::runtime_error("flush failed");
+    }
+};
+
+void run_default_report_scenario() {
+    consolix::AppComponentManager manager;
+    expect(manager.shutdown_report() == nullptr, "report must be empty before shutdown");
+    manager.add<SlowShutdownComponent>(0);
+    manager.add<FailingShutdownComponent>();
+    manager.shutdown(0);
+
+    const consolix::ShutdownReport* report = manager.shutdown_report();
+    expect(report && report->components.size() == 2, "report must list every component");
+    expect(!report->timed_out(), "unbounded shutdown must not time out");
+    expect(report->components[1].failed && report->components[1].error == "flush failed",
+           "report must record shutdown errors");
+}
+
+void run_parallel_dependency_scenario() {
+    consolix::AppComponentManager manager;
+    auto store = manager.add<StoreComponent>(20);
+    auto first = manager.add<StoreClient>(100);
+    auto second = manager.add<StoreClient>(100);
+    manager.set_shutdown_policy(consolix::ShutdownPolicy::bounded(
+        std::chrono::milliseconds(0), std::chrono::milliseconds(0), 4));
+
+    const auto start = Clock::now();
+    manager.shutdown(0);
+    const long long took = elapsed_ms(start);
+
+    expect(store->finished && first->finished && second->finished, "all components must shut down");
+    expect(took < 200, "independent components must shut down in parallel");
+    expect(store->started_at >= first->finished_at && store->started_at >= second->finished_at,
+           "a provider must shut down after the components that depend on it");
+}
+
+void run_component_deadline_scenario() {
+    consolix::AppComponentManager manager;
+    auto fast = manager.add<SlowShutdownComponent>(0);
+    auto slow = manager.add<SlowShutdownComponent>(400);
+    manager.set_shutdown_policy(consolix::ShutdownPolicy::bounded(
+        std::chrono::milliseconds(50), std::chrono::milliseconds(0)));
+
+    const auto start = Clock::now();
+    manager.shutdown(0);
+    const long long took = elapsed_ms(start);
+
+    const consolix::ShutdownReport* report = manager.shutdown_report();
+    expect(took < 250, "shutdown must continue past a component that overruns its deadline");
+    expect(report && report->timed_out(), "report must flag the overrun");
+    expect(report->components[1].timed_out, "the slow component must be marked as timed out");
+    expect(!report->components[0].timed_out && fast->finished,
+           "components after the slow one must still shut down");
+    slow->wait_finished();
+}
+
+void run_total_deadline_scenario() {
+    consolix::AppComponentManager manager;
+    auto skipped = manager.add<SlowShutdownComponent>(0);
+    auto slow = manager.add<SlowShutdownComponent>(300);
+    manager.set_shutdown_policy(consolix::ShutdownPolicy::bounded(
+        std::chrono::milliseconds(0), std::chrono::milliseconds(50)));
+
+    manager.shutdown(0);
+    const consolix::ShutdownReport* report = manager.shutdown_report();
+    expect(report->components[1].timed_out, "total deadline must stop waiting for the slow component");
+    expect(report->components[0].skipped && !skipped->finished,
+           "components not started before the total deadline must be skipped");
+    slow->wait_finished();
+}
+
+void run_runner_exit_code_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto slow = manager.add<SlowShutdownComponent>(300);
+    manager.set_shutdown_policy(consolix::ShutdownPolicy::bounded(
+        std::chrono::milliseconds(30), std::chrono::milliseconds(0)));
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    const int exit_code = runner.run_for_exit_code([&runner]() {
+        runner.request_stop(0);
+    });
+
+    expect(exit_code == CONSOLIX_SHUTDOWN_TIMEOUT_EXIT_CODE, "exit code must reflect shutdown timeouts");
+    expect(runner.shutdown_report().timed_out(), "runner must keep the shutdown report");
+    slow->wait_finished();
+}
+
+void run_runner_keeps_services_for_overrun_scenario() {
+    consolix::ServiceLocator locator;
+    locator.register_service<Journal>();
+    consolix::AppComponentManager manager(locator);
+    auto slow = manager.add<JournalingComponent>(0);
+    manager.set_shutdown_policy(consolix::ShutdownPolicy::bounded(
+        std::chrono::milliseconds(30), std::chrono::milliseconds(0)));
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    const int exit_code = runner.run_for_exit_code([&runner]() {
+        runner.request_stop(0);
+    });
+
+    expect(exit_code == CONSOLIX_SHUTDOWN_TIMEOUT_EXIT_CODE, "the overrun must be reported");
+    expect(manager.running_shutdown_tasks() == 1, "the overrunning shutdown must be counted as running");
+    expect(locator.has_service<Journal>(), "the runner must keep services while a shutdown is running");
+    slow->wait_finished();
+    expect(slow->journaled, "a shutdown overrunning the runner must still reach its services");
+    expect(locator.get_service<Journal>().entries == 1, "the late write must land in the registered service");
+    for (int i = 0; i < 1000 && manager.running_shutdown_tasks() != 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    expect(manager.running_shutdown_tasks() == 0, "a finished shutdown must no longer be counted");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_default_report_scenario();
+        run_parallel_dependency_scenario();
+        run_component_deadline_scenario();
+        run_total_deadline_scenario();
+        run_runner_exit_code_scenario();
+        run_runner_keeps_services_for_overrun_scenario();
+
+        std::cout << "Shutdown policy checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Shutdown policy test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
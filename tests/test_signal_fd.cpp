@@ -0,0 +1,155 @@
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+#if defined(__linux__)
+
+#include <unistd.h>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class SubscriberComponent final : public consolix::IAppComponent, public consolix::ISignalSubscriber {
+public:
+    std::vector<int> signals;
+    std::atomic<int> count{0};
+
+    void on_signal(int signal_number) override {
+        signals.push_back(signal_number);
+        ++count;
+    }
+
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {}
+};
+
+class PlainComponent final : public consolix::IAppComponent {
+protected:
+    bool initialize() override {
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return true;
+    }
+
+    void process() override {}
+};
+
+void run_dispatch_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto subscriber = manager.add<SubscriberComponent>();
+    manager.add<PlainComponent>();
+    expect(manager.dispatch_signal(SIGHUP) == 1, "dynamic manager must notify only subscribers");
+    expect(subscriber->signals.size() == 1 && subscriber->signals[0] == SIGHUP,
+           "subscriber must receive the dispatched signal");
+
+    consolix::StaticComponentManager<PlainComponent, SubscriberComponent> static_manager(locator);
+    expect(static_manager.dispatch_signal(SIGUSR2) == 1, "static manager must notify only subscribers");
+    expect(static_manager.get<SubscriberComponent>().count == 1, "static subscriber must receive the signal");
+}
+
+void run_service_scenario() {
+    consolix::SignalFdService service(false);
+    service.watch(SIGUSR2);
+    expect(service.watches(SIGUSR2) && !service.terminates(SIGUSR2), "watched signal must be dispatched");
+    expect(service.start(), "signalfd must start on Linux");
+    expect(service.fd() >= 0, "running service must expose its descriptor");
+
+    bool threw = false;
+    try {
+        service.watch(SIGUSR1);
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    expect(threw, "watch must be rejected while running");
+
+    ::kill(::getpid(), SIGUSR2);
+    int received = 0;
+    expect(service.read_pending([&received](int signal_number) { received = signal_number; }) == 1,
+           "pending signal must be read from the descriptor");
+    expect(received == SIGUSR2, "descriptor must report the raised signal");
+    service.stop();
+    expect(!service.is_running(), "stopped service must close its descriptor");
+}
+
+void run_runner_scenario() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto subscriber = manager.add<SubscriberComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    expect(runner.enable_signalfd(), "signalfd mode must be available on Linux");
+
+    std::thread controller([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ::kill(::getpid(), SIGHUP);
+        for (int i = 0; i < 200 && subscriber->count.load() < 1; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        ::kill(::getpid(), SIGUSR1);
+        for (int i = 0; i < 200 && subscriber->count.load() < 2; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        ::kill(::getpid(), SIGTERM);
+    });
+
+    const int exit_code = runner.run_for_exit_code();
+    controller.join();
+
+    expect(exit_code == SIGTERM, "termination signal must stop the runner with its number");
+    expect(subscriber->signals.size() == 2, "non-terminating signals must reach the subscriber");
+    expect(subscriber->signals[0] == SIGHUP && subscriber->signals[1] == SIGUSR1,
+           "signals must be dispatched in delivery order");
+}
+
+} // namespace
+
+int main() {
+    try {
+        // Block the watched set before any thread starts so that every thread inherits it
+        // and the signals raised below are consumed only through the descriptor.
+        consolix::SignalFdService().block_on_current_thread();
+
+        run_dispatch_scenario();
+        run_service_scenario();
+        run_runner_scenario();
+
+        std::cout << "SignalFd checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "SignalFd test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+#else
+
+int main() {
+    std::cout << "SignalFd checks skipped: signalfd is not available." << std::endl;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,139 @@
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+struct Trace {
+    std::vector<int> initialized;
+    std::vector<int> processed;
+    std::vector<int> shutdown;
+    int              shutdown_signal = 0;
+    bool             fail_shutdown = false;
+};
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+template <int Id>
+class TracedComponent final : public consolix::IAppComponent, public consolix::IShutdownable {
+public:
+    explicit TracedComponent(Trace& trace) :
+        m_trace(trace) {
+    }
+
+    int id() const {
+        return Id;
+    }
+
+protected:
+    bool initialize() override {
+        m_trace.initialized.push_back(Id);
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+        m_trace.processed.push_back(Id);
+    }
+
+    void shutdown(int signal) override {
+        m_trace.shutdown.push_back(Id);
+        m_trace.shutdown_signal = signal;
+        if (Id == 3 && m_trace.fail_shutdown) {
+            throw std::runtime_error("shutdown failure");
+        }
+    }
+
+private:
+    Trace& m_trace;
+    bool   m_initialized{false};
+};
+
+class PlainComponent final : public consolix::IAppComponent {
+public:
+    int processed = 0;
+
+protected:
+    bool initialize() override {
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+        if (++processed == 3) {
+            consolix::ConsoleApplicationRunner::request_current_stop(5);
+        }
+    }
+
+private:
+    bool m_initialized{false};
+};
+
+void run_lifecycle_scenario() {
+    Trace trace;
+    trace.fail_shutdown = true;
+    consolix::StaticComponentManager<TracedComponent<1>, PlainComponent, TracedComponent<3>> manager(
+        consolix::ServiceLocator::get_instance(), trace, PlainComponent(), trace);
+
+    static_assert(decltype(manager)::component_count == 3, "component_count must match the pack");
+    expect(manager.get<0>().id() == 1, "index access must reach the first component");
+    expect(manager.get<TracedComponent<3>>().id() == 3, "type access must reach the component");
+    expect(!manager.is_initialized(), "components must start uninitialized");
+
+    expect(manager.initialize(), "initialize must report success");
+    expect(manager.initialize(), "repeated initialize must stay successful");
+    expect(trace.initialized == std::vector<int>({1, 3}), "initialize must run once in declaration order");
+
+    manager.process();
+    expect(trace.processed == std::vector<int>({1, 3}), "process must run in declaration order");
+    expect(manager.get<PlainComponent>().processed == 1, "process must reach every component");
+
+    manager.shutdown(15);
+    expect(trace.shutdown == std::vector<int>({3, 1}), "shutdown must run in reverse order despite errors");
+    expect(trace.shutdown_signal == 15, "shutdown must pass the signal");
+}
+
+void run_runner_scenario() {
+    Trace trace;
+    consolix::ServiceLocator locator;
+    consolix::StaticComponentManager<TracedComponent<1>, PlainComponent> manager(
+        locator, trace, PlainComponent());
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    const int exit_code = runner.run_for_exit_code();
+
+    expect(exit_code == 5, "runner must return the requested exit code");
+    expect(manager.get<PlainComponent>().processed == 3, "runner must process until stop");
+    expect(trace.shutdown == std::vector<int>({1}), "runner must shut down shutdownable components");
+    expect(trace.shutdown_signal == 5, "runner must pass the exit code to shutdown");
+    expect(&manager.service_locator() == &locator, "manager must keep its locator");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_lifecycle_scenario();
+        run_runner_scenario();
+
+        std::cout << "StaticComponentManager checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "StaticComponentManager test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
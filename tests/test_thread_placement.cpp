@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+#if !defined(_WIN32)
+void make_dirs(const std::string& path) {
+    for (std::size_t slash = path.find('/', 1); ; slash = path.find('/', slash + 1)) {
+        ::mkdir(path.substr(0, slash).c_str(), 0755);
+        if (slash == std::string::npos) {
+            return;
+        }
+    }
+}
+
+void write_file(const std::string& directory, const std::string& name, const std::string& value) {
+    make_dirs(directory);
+    std::ofstream(directory + "/" + name) << value << "\n";
+}
+
+void write_cache(const std::string& cpu, int index, int level, const char* type, const char* size,
+                 const std::string& shared) {
+    const std::string directory = cpu + "/cache/index" + std::to_string(index);
+    write_file(directory, "level", std::to_string(level));
+    write_file(directory, "type", type);
+    write_file(directory, "size", size);
+    write_file(directory, "shared_cpu_list", shared);
+}
+
+/// Two NUMA nodes with one L3 each; CPUs 2k and 2k+1 are SMT siblings.
+std::string make_fake_sysfs() {
+    char pattern[] = "/tmp/consolix_sysfs_XXXXXX";
+    const char* created = ::mkdtemp(pattern);
+    expect(created != nullptr, "a temporary sysfs directory must be created");
+    const std::string root = created;
+
+    write_file(root + "/cpu", "online", "0-7");
+    write_file(root + "/node", "online", "0-1");
+    write_file(root + "/node/node0", "cpulist", "0-3");
+    write_file(root + "/node/node1", "cpulist", "4-7");
+    for (int id = 0; id < 8; ++id) {
+        const std::string cpu = root + "/cpu/cpu" + std::to_string(id);
+        const int core = id / 2;
+        const std::string siblings = std::to_string(core * 2) + "-" + std::to_string(core * 2 + 1);
+        write_file(cpu + "/topology", "core_id", std::to_string(core % 2));
+        write_file(cpu + "/topology", "physical_package_id", std::to_string(id / 4));
+        write_file(cpu + "/topology", "thread_siblings_list", siblings);
+        write_cache(cpu, 0, 1, "Data", "32K", siblings);
+        write_cache(cpu, 1, 1, "Instruction", "32K", siblings);
+        write_cache(cpu, 2, 2, "Unified", "1024K", siblings);
+        write_cache(cpu, 3, 3, "Unified", "8M", id < 4 ? "0-3" : "4-7");
+    }
+    return root;
+}
+#endif
+
+void test_parsers() {
+    const std::vector<int> ids = consolix::CpuTopology::parse_cpu_list("8,0-3,10-11");
+    const std::vector<int> expected = {0, 1, 2, 3, 8, 10, 11};
+    expect(ids == expected, "CPU lists must expand ranges and sort ids");
+    expect(consolix::CpuTopology::parse_cpu_list("").empty(), "an empty CPU list must be empty");
+    expect(consolix::CpuTopology::parse_size("32K") == 32 * 1024, "K sizes must be parsed");
+    expect(consolix::CpuTopology::parse_size("8M") == 8 * 1024 * 1024, "M sizes must be parsed");
+}
+
+void test_fallback_topology() {
+    const consolix::CpuTopology topology("/nonexistent/consolix/sysfs");
+    expect(!topology.from_sysfs(), "a missing sysfs must use the fallback");
+    expect(static_cast<int>(topology.cpus().size()) == std::max(consolix::get_cpu_count(), 1),
+           "the fallback must report get_cpu_count() CPUs");
+    expect(topology.nodes().empty(), "the fallback has no NUMA nodes");
+    expect(topology.last_level_cache(0) == nullptr, "the fallback has no cache data");
+
+    const consolix::CpuTopology machine;
+#   if defined(__linux__)
+    expect(machine.from_sysfs(), "Linux must provide a sysfs topology");
+#   endif
+    expect(!machine.cpus().empty() && machine.core_count() >= 1, "the machine must have CPUs");
+}
+
+#if !defined(_WIN32)
+void test_sysfs_topology(const consolix::CpuTopology& topology) {
+    expect(topology.from_sysfs(), "the fake sysfs must be read");
+    expect(topology.cpus().size() == 8, "every online CPU must be listed");
+    expect(topology.core_count() == 4, "SMT siblings must count as one core");
+    expect(topology.smt_siblings(4, 5) && !topology.smt_siblings(4, 6) && !topology.smt_siblings(4, 4),
+           "SMT siblings must come from thread_siblings_list");
+    const consolix::CpuCache* l3 = topology.last_level_cache(1);
+    expect(l3 && l3->level == 3 && l3->size == 8u * 1024 * 1024, "the last-level cache must be L3");
+    expect(topology.find(0)->caches.size() == 4, "every cache index must be read");
+    expect(topology.share_last_level_cache(0, 3) && !topology.share_last_level_cache(0, 4),
+           "L3 sharing must follow shared_cpu_list");
+    expect(topology.nodes() == std::vector<int>({0, 1}), "nodes must come from node/online");
+    expect(topology.node_of(5) == 1 && topology.node_cpus(0) == std::vector<int>({0, 1, 2, 3}),
+           "CPUs must be mapped to their nodes");
+}
+
+void test_placement_rules(const consolix::CpuTopology& topology) {
+    consolix::ThreadPlacement near(consolix::ThreadPlacementPolicy::near(0), topology);
+    expect(near.reserve_cpu("a") == 2, "near placement must pick a core sharing the anchor's L3");
+    expect(near.reserve_cpu("b") == 3, "near placement must stay on the anchor's L3 and node");
+    const int third = near.reserve_cpu("c");
+    expect(third == 2 || third == 3, "near placement must prefer sharing over leaving the L3");
+
+    consolix::ThreadPlacement isolated(consolix::ThreadPlacementPolicy::isolated(0), topology);
+    expect(isolated.reserve_cpu("a") == 2, "isolated placement must skip the anchor's sibling");
+    expect(isolated.reserve_cpu("b") == 4, "isolated placement must avoid siblings of placed threads");
+    expect(isolated.reserve_cpu("c") == 6, "isolated placement must spread over free cores");
+    for (int i = 0; i < 16; ++i) {
+        const int cpu = isolated.reserve_cpu("more");
+        expect(cpu != 0 && cpu != 1, "helpers must never land on the anchor core");
+    }
+    expect(isolated.assignments().size() == 19, "every reservation must be recorded");
+
+    consolix::ThreadPlacementPolicy numa = consolix::ThreadPlacementPolicy::isolated(5);
+    numa.set_numa_local(true);
+    consolix::ThreadPlacement numa_placement(numa, topology);
+    expect(numa_placement.reserve_cpu("a") == 6, "NUMA-local placement must stay on the anchor's node");
+
+    consolix::ThreadPlacement disabled(consolix::ThreadPlacementPolicy::disabled(), topology);
+    expect(disabled.reserve_cpu("a") == -1, "a disabled policy must not choose CPUs");
+
+    consolix::ThreadPlacement churn(consolix::ThreadPlacementPolicy::isolated(0), topology);
+    expect(churn.reserve_cpu("a") == 2, "the first helper must take the first free core");
+    churn.release(0);
+    expect(churn.reserve_cpu("b") == 2, "released assignments must not count as load");
+    expect(churn.assignments()[0].released && !churn.assignments()[1].released,
+           "only the released assignment must be marked");
+}
+#endif
+
+void test_single_cpu_is_left_to_the_loop() {
+    consolix::ThreadPlacement placement(
+        consolix::ThreadPlacementPolicy::isolated(0),
+        consolix::CpuTopology("/nonexistent/consolix/sysfs"));
+    if (placement.topology().cpus().size() == 1) {
+        expect(placement.reserve_cpu("a") == -1, "the only CPU must be left to the loop thread");
+    }
+}
+
+void test_exited_threads_are_released() {
+    std::shared_ptr<consolix::ThreadPlacement> placement =
+        std::make_shared<consolix::ThreadPlacement>(consolix::ThreadPlacementPolicy::disabled());
+    bool held = false;
+    std::thread helper([placement, &held]() {
+        const consolix::PlacedThread placed = consolix::place_current_thread(placement, "cx-test");
+        held = !placement->assignments()[0].released;
+    });
+    helper.join();
+    expect(held, "a running thread must hold its assignment");
+    expect(placement->assignments().size() == 1 && placement->assignments()[0].released,
+           "an exited thread must release its assignment");
+}
+
+void test_runner_places_consolix_threads() {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    manager.set_processing_threads(3);
+    manager.add<consolix::PosixSignalWakeComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    runner.set_thread_placement(consolix::ThreadPlacementPolicy::isolated());
+    expect(runner.thread_placement().enabled(), "the runner must keep the policy");
+
+    int iterations = 0;
+    const int exit_code = runner.run_for_exit_code([&]() {
+        if (++iterations == 1) {
+            runner.request_stop(0);
+        }
+    });
+    expect(exit_code == 0, "the runner must stop normally");
+
+    const std::vector<consolix::ThreadAssignment> assignments = runner.thread_assignments();
+    bool worker = false;
+    bool watcher = false;
+    for (const consolix::ThreadAssignment& assignment : assignments) {
+        worker = worker || assignment.name == "cx-worker-1" || assignment.name == "cx-worker-2";
+        watcher = watcher || assignment.name == "cx-signal";
+#       if defined(__linux__)
+        expect(assignment.named, "Consolix threads must be named");
+        expect(assignment.cpu < 0 || assignment.pinned, "a chosen CPU must be pinned");
+#       endif
+    }
+    expect(worker, "pool workers must be placed");
+#   if !defined(_WIN32)
+    expect(watcher, "the signal watcher must be placed");
+#   endif
+}
+
+#if defined(__linux__)
+std::vector<int> current_affinity() {
+    std::vector<int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
+/// Starts a thread during initialization, as a logging backend would, and records its affinity.
+class ThreadStartingComponent final : public consolix::IAppComponent {
+public:
+    std::vector<int> init_thread_cpus;
+
+protected:
+    bool initialize() override {
+        std::thread thread([this]() {
+            init_thread_cpus = current_affinity();
+        });
+        thread.join();
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {}
+
+private:
+    bool m_initialized{false};
+};
+
+void test_init_threads_avoid_the_anchor() {
+    const std::vector<int> before = current_affinity();
+    expect(!before.empty(), "the test thread must have an affinity");
+    const int anchor = before.front();
+
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto component = manager.add<ThreadStartingComponent>();
+    consolix::ConsoleApplicationRunner runner(manager);
+    runner.set_thread_placement(consolix::ThreadPlacementPolicy::isolated(anchor));
+
+    std::vector<int> loop_cpus;
+    const int exit_code = runner.run_for_exit_code([&]() {
+        loop_cpus = current_affinity();
+        runner.request_stop(0);
+    });
+    expect(exit_code == 0, "the runner must stop normally");
+    expect(!component->init_thread_cpus.empty(), "the initialization thread must have run");
+    if (before.size() > 1) {
+        expect(std::find(component->init_thread_cpus.begin(), component->init_thread_cpus.end(), anchor) ==
+               component->init_thread_cpus.end(), "threads started during initialization must avoid the anchor");
+        expect(loop_cpus == std::vector<int>(1, anchor), "the loop thread must be pinned to the anchor");
+    } else {
+        expect(component->init_thread_cpus == before, "with one CPU the affinity must be left alone");
+    }
+    expect(current_affinity() == before, "the runner must restore the loop thread's affinity");
+}
+#endif
+
+} // namespace
+
+int main() {
+    try {
+        test_parsers();
+        test_fallback_topology();
+#       if !defined(_WIN32)
+        const std::string root = make_fake_sysfs();
+        const consolix::CpuTopology topology(root);
+        std::system(("rm -rf " + root).c_str());
+        test_sysfs_topology(topology);
+        test_placement_rules(topology);
+#       endif
+        test_single_cpu_is_left_to_the_loop();
+        test_exited_threads_are_released();
+        test_runner_places_consolix_threads();
+#       if defined(__linux__)
+        test_init_threads_avoid_the_anchor();
+#       endif
+
+        std::cout << "Thread placement checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Thread placement test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
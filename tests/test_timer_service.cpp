@@ -0,0 +1,231 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+typedef consolix::TimerService::Clock Clock;
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void run_basic_scenario() {
+    consolix::TimerService timers;
+    const Clock::time_point start = Clock::now();
+    expect(timers.next_expiry() == Clock::time_point::max(), "an empty wheel must have no expiry");
+
+    int once = 0;
+    int every = 0;
+    timers.schedule_after(std::chrono::milliseconds(10), [&once]() { ++once; });
+    const consolix::TimerService::TimerId periodic =
+        timers.schedule_every(std::chrono::milliseconds(5), [&every]() { ++every; });
+    expect(timers.size() == 2, "both timers must be pending");
+    expect(timers.next_expiry() <= start + std::chrono::milliseconds(7), "next expiry must be the periodic timer");
+
+    expect(timers.advance(start + std::chrono::milliseconds(3)) == 0, "nothing is due after 3 ms");
+    timers.advance(start + std::chrono::milliseconds(13));
+    expect(once == 1, "the one-shot timer must fire once");
+    expect(every == 1, "a late periodic timer must skip missed runs");
+    expect(timers.size() == 1, "a fired one-shot timer must be released");
+
+    timers.advance(start + std::chrono::milliseconds(40));
+    expect(once == 1, "a one-shot timer must not fire again");
+    expect(every == 2, "the periodic timer must fire again");
+
+    expect(timers.cancel(periodic), "a pending timer must be cancellable");
+    expect(!timers.cancel(periodic), "a cancelled timer must not be cancelled twice");
+    expect(timers.size() == 0, "cancelled timers must be released");
+    timers.advance(start + std::chrono::milliseconds(100));
+    expect(every == 2, "a cancelled timer must not fire");
+    expect(!timers.cancel(0), "id 0 must never name a timer");
+}
+
+void run_far_timer_scenario() {
+    consolix::TimerService timers;
+    const Clock::time_point start = Clock::now();
+    int fired = 0;
+    timers.schedule_after(std::chrono::hours(30), [&fired]() { ++fired; });
+    timers.schedule_after(std::chrono::hours(24 * 60), [&fired]() { fired += 10; });
+
+    expect(timers.next_expiry() <= start + std::chrono::hours(30) + std::chrono::milliseconds(1),
+           "next expiry must never lie after the real expiry");
+    timers.advance(start + std::chrono::hours(29));
+    expect(fired == 0, "a far timer must not fire early");
+    timers.advance(start + std::chrono::hours(30) + std::chrono::milliseconds(2));
+    expect(fired == 1, "a timer beyond the third level must fire after cascading");
+    timers.advance(start + std::chrono::hours(24 * 59));
+    expect(fired == 1, "a clamped timer must not fire early");
+    timers.advance(start + std::chrono::hours(24 * 60) + std::chrono::milliseconds(2));
+    expect(fired == 11, "a timer beyond the wheel range must fire after re-cascading");
+}
+
+void run_randomized_scenario() {
+    consolix::TimerService timers;
+    const Clock::time_point start = Clock::now();
+    std::mt19937 random(12345);
+    std::uniform_int_distribution<int> delays(0, 200000);
+
+    const std::size_t count = 5000;
+    std::vector<int> fired(count, 0);
+    std::vector<Clock::time_point> due(count);
+    std::vector<Clock::time_point> fired_at(count);
+    Clock::time_point now = start;
+    std::vector<consolix::TimerService::TimerId> ids;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::chrono::milliseconds delay(delays(random));
+        due[i] = start + delay;
+        ids.push_back(timers.schedule_after(delay, [&, i]() {
+            ++fired[i];
+            fired_at[i] = now;
+        }));
+    }
+    for (std::size_t i = 0; i < count; i += 7) {
+        expect(timers.cancel(ids[i]), "pending timers must be cancellable");
+    }
+
+    std::uniform_int_distribution<int> steps(1, 3000);
+    while (now < start + std::chrono::milliseconds(200010)) {
+        now += std::chrono::milliseconds(steps(random));
+        timers.advance(now);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i % 7 == 0) {
+            expect(fired[i] == 0, "cancelled timers must not fire");
+            continue;
+        }
+        expect(fired[i] == 1, "every timer must fire exactly once");
+        expect(fired_at[i] >= due[i], "no timer may fire before it is due");
+    }
+    expect(timers.size() == 0, "every timer must be released");
+}
+
+void run_slack_scenario() {
+    consolix::TimerService timers;
+    const Clock::time_point start = Clock::now();
+
+    int batch = 0;
+    for (int i = 0; i < 8; ++i) {
+        timers.schedule_after(std::chrono::milliseconds(100 + i), [&batch]() { ++batch; },
+                              std::chrono::milliseconds(16));
+    }
+    expect(timers.advance(start + std::chrono::milliseconds(99)) == 0, "slack must never fire timers early");
+    expect(timers.advance(start + std::chrono::milliseconds(140)) == 8, "coalesced timers must fire");
+}
+
+void run_reentrancy_scenario() {
+    consolix::TimerService timers;
+    const Clock::time_point start = Clock::now();
+
+    consolix::TimerService::TimerId self = 0;
+    consolix::TimerService::TimerId victim = 0;
+    int self_runs = 0;
+    int victim_runs = 0;
+    int child_runs = 0;
+    self = timers.schedule_every(std::chrono::milliseconds(1), [&]() {
+        ++self_runs;
+        timers.cancel(self);
+        timers.cancel(victim);
+        timers.schedule_after(std::chrono::milliseconds(1), [&child_runs]() { ++child_runs; });
+    });
+    victim = timers.schedule_after(std::chrono::milliseconds(5), [&victim_runs]() { ++victim_runs; });
+    timers.advance(start + std::chrono::milliseconds(200));
+    expect(self_runs == 1 && victim_runs == 0, "callbacks must be able to cancel timers in the same batch");
+    timers.advance(start + std::chrono::milliseconds(300));
+    expect(child_runs == 1, "callbacks must be able to schedule timers");
+    expect(timers.size() == 0, "all timers must be released");
+
+    std::atomic<int> wakes(0);
+    timers.set_wake_callback([&wakes]() { ++wakes; });
+    timers.schedule_after(std::chrono::seconds(10), []() {});
+    timers.schedule_after(std::chrono::seconds(20), []() {});
+    timers.schedule_after(std::chrono::seconds(1), []() {});
+    expect(wakes == 2, "only timers expiring before the earliest one must wake the loop");
+}
+
+class TimerComponent final : public consolix::IAppComponent {
+public:
+    std::atomic<int> ticks{0};
+    std::atomic<int> once{0};
+    std::atomic<int> passes{0};
+
+protected:
+    bool initialize() override {
+        auto& timers = consolix::get_service<consolix::TimerService>();
+        timers.schedule_every(std::chrono::milliseconds(10), [this]() { ++ticks; });
+        timers.schedule_after(std::chrono::milliseconds(30), [this]() { ++once; });
+        m_initialized = true;
+        return true;
+    }
+
+    bool is_initialized() const override {
+        return m_initialized;
+    }
+
+    void process() override {
+        ++passes;
+    }
+
+private:
+    bool m_initialized{false};
+};
+
+void run_runner_scenario(bool reactor) {
+    consolix::ServiceLocator locator;
+    consolix::AppComponentManager manager(locator);
+    auto component = manager.add<TimerComponent>();
+
+    consolix::ConsoleApplicationRunner runner(manager);
+    if (reactor && !runner.enable_reactor()) {
+        return;
+    }
+
+    std::atomic<int> posted{0};
+    std::thread controller([&runner, &locator, &posted]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        locator.find_service<consolix::TimerService>()->schedule_after(
+            std::chrono::milliseconds(1), [&posted]() { ++posted; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        runner.request_stop(0);
+    });
+    const int exit_code = runner.run_for_exit_code();
+    controller.join();
+
+    expect(exit_code == 0, "runner with timers must stop normally");
+    expect(component->once == 1, "one-shot timer must run on the loop");
+    expect(component->ticks >= 5, "periodic timer must run about every 10 ms");
+    expect(posted == 1, "a timer scheduled from another thread must run on the loop");
+    if (reactor) {
+        expect(component->passes < 60, "timers must bound the reactor wait without busy passes");
+    }
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_basic_scenario();
+        run_far_timer_scenario();
+        run_randomized_scenario();
+        run_slack_scenario();
+        run_reentrancy_scenario();
+        run_runner_scenario(false);
+        run_runner_scenario(true);
+
+        std::cout << "Timer service checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Timer service test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
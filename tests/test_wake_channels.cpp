@@ -0,0 +1,139 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <consolix/core.hpp>
+
+namespace {
+
+void expect(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+typedef consolix::LoopWakeService::Channel Channel;
+typedef consolix::LoopWakeService::Generation Generation;
+
+void run_naming_scenario() {
+    consolix::LoopWakeService service;
+    const Channel network = service.channel("network");
+    const Channel storage = service.channel("storage");
+    expect(network != storage, "different names must get different channels");
+    expect(service.channel("network") == network, "a name must keep its channel");
+
+    bool threw = false;
+    try {
+        service.wake(static_cast<Channel>(consolix::LoopWakeService::channel_limit()));
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    expect(threw, "channels beyond the limit must be rejected");
+
+    threw = false;
+    try {
+        for (std::size_t i = 0; i <= consolix::LoopWakeService::channel_limit(); ++i) {
+            service.channel("topic-" + std::to_string(i));
+        }
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    expect(threw, "naming more channels than the limit must fail");
+}
+
+void run_targeted_wake_scenario() {
+    consolix::LoopWakeService service;
+    const Channel network = service.channel("network");
+    const Channel storage = service.channel("storage");
+
+    std::atomic<int> network_woken(0);
+    std::atomic<int> storage_woken(0);
+    std::atomic<int> global_woken(0);
+    std::atomic<int> ready(0);
+
+    std::thread network_waiter([&]() {
+        Generation observed = service.generation(network);
+        ++ready;
+        if (service.wait_for_change(network, observed, std::chrono::milliseconds(2000))) {
+            ++network_woken;
+        }
+    });
+    std::thread storage_waiter([&]() {
+        Generation observed = service.generation(storage);
+        ++ready;
+        if (service.wait_for_change(storage, observed, std::chrono::milliseconds(300))) {
+            ++storage_woken;
+        }
+    });
+    std::thread global_waiter([&]() {
+        Generation observed = service.generation();
+        ++ready;
+        if (service.wait_for_change(observed, std::chrono::milliseconds(300))) {
+            ++global_woken;
+        }
+    });
+
+    while (ready.load() < 3) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const Generation global_before = service.generation();
+    const auto woken_at = std::chrono::steady_clock::now();
+    service.wake(network);
+    network_waiter.join();
+    const auto network_latency = std::chrono::steady_clock::now() - woken_at;
+    storage_waiter.join();
+    global_waiter.join();
+
+    expect(network_woken == 1, "the woken channel's waiter must run");
+    expect(network_latency < std::chrono::milliseconds(250), "channel wake must not wait for a timeout");
+    expect(storage_woken == 0, "other channels must stay asleep");
+    expect(global_woken == 0, "global waiters must stay asleep on a channel wake");
+    expect(service.generation() == global_before, "channel wakes must not advance the global generation");
+}
+
+void run_broadcast_scenario() {
+    consolix::LoopWakeService service;
+    const Channel channel = service.channel("jobs");
+    std::atomic<bool> woken(false);
+    std::atomic<bool> ready(false);
+
+    std::thread waiter([&]() {
+        Generation observed = service.generation(channel);
+        ready = true;
+        woken = service.wait_for_change(channel, observed, std::chrono::milliseconds(2000));
+    });
+    while (!ready.load()) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    service.wake_all();
+    waiter.join();
+    expect(woken.load(), "wake_all must still wake channel waiters");
+
+    Generation observed = service.generation(channel);
+    service.wake(channel);
+    expect(service.wait_for_change(channel, observed, std::chrono::milliseconds(0)),
+           "a wake before the wait must be observed without blocking");
+    expect(!service.wait_for_change(channel, observed, std::chrono::milliseconds(10)),
+           "an observed wake must not be reported twice");
+}
+
+} // namespace
+
+int main() {
+    try {
+        run_naming_scenario();
+        run_targeted_wake_scenario();
+        run_broadcast_scenario();
+
+        std::cout << "Wake channel checks passed." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Wake channel test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}